@@ -25,6 +25,8 @@ import "libraries/roxy/utilities/roxyEase"
 
 -- Import Roxy managers
 import "libraries/roxy/core/managers/ConfigurationManager"
+import "libraries/roxy/core/managers/SchedulerManager"
+import "libraries/roxy/core/managers/AssetManager"
 import "libraries/roxy/core/managers/SettingsManager"
 import "libraries/roxy/core/managers/GameDataManager"
 import "libraries/roxy/core/managers/SequenceManager"
@@ -34,6 +36,7 @@ import "libraries/roxy/core/managers/TransitionManager"
 
 -- Import Roxy core components
 import "libraries/roxy/core/sequences/RoxySequence"
+import "libraries/roxy/core/sequences/RoxyVectorSequence"
 import "libraries/roxy/core/sprites/RoxySprite"
 import "libraries/roxy/core/animations/RoxyAnimation"
 import "libraries/roxy/core/scenes/RoxyScene"
@@ -41,6 +44,7 @@ import "libraries/roxy/core/ui/RoxyMenu"
 
 -- Singleton instances for managers
 local configurationManager <const> = ConfigurationManager.getInstance()
+local schedulerManager <const> = SchedulerManager.getInstance()
 local settingsManager <const> = SettingsManager.getInstance()
 local gameDataManager <const> = GameDataManager.getInstance()
 local sequenceManager <const> = SequenceManager.getInstance()
@@ -66,18 +70,34 @@ local Sprite <const> = Graphics.sprite
 local Timer <const> = pd.timer
 local FrameTimer <const> = pd.frameTimer
 local Ease <const> = roxy.easingFunctions
+local Time <const> = roxy.time
+local Profiler <const> = roxy.profiler
 local Geometry <const> = pd.geometry
 local UI <const> = pd.ui
 
 -- Get display dimensions and center coordinates
 local displayWidth, displayHeight, displayCenterX, displayCenterY = roxy.graphics.getDisplaySize()
 
+-- Profiler zones for the phases of `Roxy:update`
+local PHASE_INPUT <const> = Profiler.registerZone("input")
+local PHASE_SEQUENCES <const> = Profiler.registerZone("sequences")
+local PHASE_SPRITES <const> = Profiler.registerZone("sprites")
+local PHASE_SCENE <const> = Profiler.registerZone("scene")
+local PHASE_CAPTURE <const> = Profiler.registerZone("capture")
+local PHASE_TRANSITION <const> = Profiler.registerZone("transition")
+local PHASE_CRANK <const> = Profiler.registerZone("crank")
+local PHASE_TIMERS <const> = Profiler.registerZone("timers")
+local PHASE_SCHEDULER <const> = Profiler.registerZone("scheduler")
+
 class("Roxy").extends()
 
 -- ! Initialize Roxy
 function Roxy:init()
 	self.engineInitialized = false
 	self.showFPS = false
+	self.fixedTimeStep = 0  -- Fixed step for sequence updates, or 0 to use the frame's delta time
+	self.profilerEnabled = false
+	self.showProfilerOverlay = false
 	self.fpsPosition = "bottomRight" -- Default FPS position
 	self:setFpsXY()
 end
@@ -165,6 +185,23 @@ function Roxy:new(startingSceneClass, startingTransitionName, startingTransition
 		error("ERROR: Problem adding menu item: " .. error)
 	end
 	
+	-- Bake lookup tables for the transcendental easings if enabled in the configuration
+	Ease.setLUTEnabled(config.useEasingLookupTables == true)
+	
+	-- Preallocate the engine-wide sequence pool across the first frames' spare time
+	sequenceManager:populatePool(config.sequencePoolSize, config.sequencePoolEasingCapacity, true)
+	
+	-- Set up delta time smoothing and spike clamping from the configuration.
+	-- Delta time is measured with the system's elapsed time, which Roxy resets each frame.
+	Time.setDeltaTimeOptions(config.maxDeltaTime or 0, config.deltaTimeSmoothing or 0)
+	
+	-- Advance sequences in fixed steps if enabled in the configuration
+	Time.setFixedStep(config.fixedTimeStep or 0, config.maxFixedSteps)
+	self.fixedTimeStep = Time.getFixedStep()
+	
+	-- Time each phase of the update loop if enabled in the configuration
+	self:setProfilerEnabled(config.profiler == true, config.profilerOverlay == true, config.profilerFrames)
+	
 	-- Configure FPS display settings from the current configuration
 	self.showFPS = config.showFPS
 	self:updateFpsPosition(config.fpsPosition or self.fpsPosition)
@@ -198,37 +235,81 @@ function Roxy:setShowFPS(show)
 	self.showFPS = show
 end
 
+-- ! Profiler
+-- Times the phases of the update loop in C (roxy_profiler.c); scenes can add their own zones with roxy.profiler
+function Roxy:setProfilerEnabled(enabled, showOverlay, frameCount)
+	self.profilerEnabled = enabled and Profiler.setEnabled(true, frameCount) or false
+	if not self.profilerEnabled then
+		Profiler.setEnabled(false)
+	end
+	self.showProfilerOverlay = self.profilerEnabled and showOverlay == true
+end
+
+-- Writes the min, average, max and 99th percentile time of each zone as CSV to the Data folder
+function Roxy:dumpProfile(path)
+	return Profiler.dump(path or "profile.csv")
+end
+
 -- ! Main Update Loop
 function Roxy:update()
 	local deltaTime = roxy.updateDeltaTime()  -- Calculate delta time for the current frame
 	
+	local profiling = self.profilerEnabled
+	if profiling then Profiler.beginFrame() end
+	
 	local isTransitioning = transitionManager:getIsTransitioning()
 	local currentTransition = transitionManager.currentTransition
 	
 	-- Handle user input through the input manager
-	inputManager:handleInput()
+	if profiling then Profiler.phase(PHASE_INPUT) end
+	inputManager:handleInput(deltaTime)
+	
+	-- Resume transitions waiting on the new scene's assets
+	if isTransitioning then
+		transitionManager:update()
+	end
 	
-	-- Update all active animation sequences
-	sequenceManager:update(deltaTime)
+	-- Update all active animation sequences, in fixed steps when a fixed timestep is configured
+	if profiling then Profiler.phase(PHASE_SEQUENCES) end
+	local fixedTimeStep = self.fixedTimeStep
+	if fixedTimeStep > 0 then
+		local stepCount = Time.advanceFixedStep(deltaTime)
+		for i = 1, stepCount do
+			sequenceManager:update(fixedTimeStep)
+		end
+	else
+		sequenceManager:update(deltaTime)
+	end
 	
-	-- Capture transition screenshots if required
-	if isTransitioning and currentTransition:getCaptureScreenshotsDuringTransition() then
+	-- Repaint the whole screen when the transition captures the new scene, so no transition pixels are left in the capture
+	local isCapturing = isTransitioning and currentTransition and currentTransition:getCaptureScreenshotsDuringTransition()
+	if isCapturing then
 		transitionManager:prepareTransitionScreenshot()
 	end
 	
 	-- Update sprites and manage background layers
+	if profiling then Profiler.phase(PHASE_SPRITES) end
 	Sprite.update()
 	
 	-- Update the current scene if it is not paused
+	if profiling then Profiler.phase(PHASE_SCENE) end
 	local currentScene = sceneManager:getCurrentScene()
 	if currentScene and not currentScene.isPaused then
 		currentScene:update()
 	end
 	
+	-- Capture the new scene for the transition if required, before the transition draws over it
+	if profiling then Profiler.phase(PHASE_CAPTURE) end
+	if isCapturing then
+		transitionManager:captureTransitionScreenshot()
+	end
+	
 	-- Execute transition drawing logic
+	if profiling then Profiler.phase(PHASE_TRANSITION) end
 	transitionManager:executeTransitionDrawing()
 	
 	-- Draw the crank indicator if it is enabled and necessary
+	if profiling then Profiler.phase(PHASE_CRANK) end
 	local crankIndicator = inputManager:getCrankIndicator()
 	if crankIndicator and (pd.isCrankDocked() or inputManager:getCrankIndicatorForced()) then
 		UI.crankIndicator:draw()
@@ -240,8 +321,20 @@ function Roxy:update()
 	end
 	
 	-- Update all SDK timers
+	if profiling then Profiler.phase(PHASE_TIMERS) end
 	Timer.updateTimers()
 	FrameTimer.updateTimers()
+	
+	-- Run deferred jobs in the time left in the frame
+	if profiling then Profiler.phase(PHASE_SCHEDULER) end
+	schedulerManager:run()
+	
+	if profiling then
+		Profiler.endFrame()
+		if self.showProfilerOverlay then
+			Profiler.drawOverlay(0, 0)  -- Shows the stats up to the previous frame
+		end
+	end
 end
 
 -- Set up the main update loop for the game
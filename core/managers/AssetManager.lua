@@ -0,0 +1,289 @@
+local configurationManager <const> = ConfigurationManager.getInstance()
+local schedulerManager <const> = SchedulerManager.getInstance()
+
+local pd <const> = playdate
+local Object <const> = pd.object
+local Graphics <const> = pd.graphics
+
+class("AssetManager").extends()
+
+-- Singleton instance for managing assets globally
+local instance = nil
+
+-- Default memory budget for cached assets, in bytes
+local DEFAULT_BUDGET <const> = 2097152
+
+-- Scheduler priority of manifest loading, ahead of default-priority jobs like deferred saves
+local LOADER_PRIORITY <const> = 10
+
+-- Bytes used by a 1-bit bitmap, with rows padded to 32 bits, doubled when it has a mask
+local function getImageBytes(image)
+	local width, height = image:getSize()
+	local bytes = ((width + 31) // 32) * 4 * height
+	if image.hasMask and image:hasMask() then
+		bytes *= 2
+	end
+	return bytes
+end
+
+-- Shared asset cache: each asset is loaded once, on first use, and handed out to everyone who asks for it.
+-- Acquiring an asset adds a reference and `release` removes one. Assets without references stay cached
+-- for reuse until the cache goes over its memory budget, then the least recently used ones are evicted.
+function AssetManager:init()
+	AssetManager.super.init(self)
+
+	self.entries = {}  -- Cache entries by key
+	self.keysByAsset = setmetatable({}, { __mode = "k" })  -- Asset -> key, for `release`
+	self.budget = configurationManager:getConfig().assetCacheBudget or DEFAULT_BUDGET
+	self.totalBytes = 0
+	self.useCounter = 0  -- Increases with each acquire, ordering entries from least to most recently used
+	self.stats = {
+		hits = 0,		-- Acquires served from the cache
+		misses = 0,		-- Acquires that had to load the asset
+		evictions = 0	-- Assets dropped to stay in the budget
+	}
+end
+
+-- ! Acquire and Release
+-- Returns the asset cached under `key`, loading it with `loadFunction(...)` on first use.
+-- `kind` ("image", "imagetable" or anything else) is used to estimate the asset's memory.
+function AssetManager:acquire(key, kind, loadFunction, ...)
+	local entry = self.entries[key]
+	if entry then
+		self.stats.hits += 1
+	else
+		local asset = loadFunction(...)
+		if not asset then
+			warn("Warning: Failed to load asset '" .. tostring(key) .. "'.")
+			return nil
+		end
+
+		entry = {
+			key = key,
+			asset = asset,
+			kind = kind,
+			bytes = self:estimateBytes(asset, kind),
+			refCount = 0,
+			lastUsed = 0
+		}
+		self.entries[key] = entry
+		self.keysByAsset[asset] = key
+		self.totalBytes += entry.bytes
+		self.stats.misses += 1
+	end
+
+	self.useCounter += 1
+	entry.refCount += 1
+	entry.lastUsed = self.useCounter
+
+	self:trim()  -- Loading may have gone over the budget
+	return entry.asset
+end
+
+-- Removes a reference to an asset; unreferenced assets stay cached until they are evicted
+function AssetManager:release(asset)
+	local key = asset and self.keysByAsset[asset]
+	local entry = key and self.entries[key]
+	if not entry then return end
+
+	if entry.refCount > 0 then
+		entry.refCount -= 1
+	end
+end
+
+-- Image loaded from a path
+function AssetManager:getImage(path)
+	return self:acquire("image:" .. path, "image", Graphics.image.new, path)
+end
+
+-- Image table loaded from a path
+function AssetManager:getImagetable(path)
+	return self:acquire("imagetable:" .. path, "imagetable", Graphics.imagetable.new, path)
+end
+
+-- Image filled with a solid color
+function AssetManager:getSolidImage(width, height, color)
+	return self:acquire("solid:" .. width .. "x" .. height .. ":" .. color, "image", Graphics.image.new, width, height, color)
+end
+
+-- Loads an asset ahead of time without keeping a reference to it
+function AssetManager:preload(key, kind, loadFunction, ...)
+	local asset = self:acquire(key, kind, loadFunction, ...)
+	self:release(asset)
+	return asset
+end
+
+-- ! Manifests
+-- Starts loading the assets listed in a manifest across frames, and returns a loader for its progress.
+-- A manifest lists paths by kind: `{ images = { "images/background" }, imagetables = { "images/walk" } }`.
+-- The loader holds a reference to each asset until `release`. Returns nil if the manifest is empty.
+function AssetManager:loadManifest(manifest, name)
+	if not manifest then return nil end
+
+	local loader = RoxyAssetLoader(self, manifest, name)
+	if loader:getTotal() == 0 then return nil end
+
+	loader:start()
+	return loader
+end
+
+-- ! Memory
+function AssetManager:estimateBytes(asset, kind)
+	if kind == "image" then
+		return getImageBytes(asset)
+	elseif kind == "imagetable" then
+		local bytes = 0
+		for i = 1, #asset do
+			bytes += getImageBytes(asset:getImage(i))
+		end
+		return bytes
+	end
+	return 0
+end
+
+-- Evicts the least recently used unreferenced assets until the cache is within its budget
+function AssetManager:trim(budget)
+	budget = budget or self.budget
+	while self.totalBytes > budget do
+		local oldest = nil
+		for _, entry in pairs(self.entries) do
+			if entry.refCount == 0 and (not oldest or entry.lastUsed < oldest.lastUsed) then
+				oldest = entry
+			end
+		end
+		if not oldest then return end  -- Everything left is in use
+
+		self.entries[oldest.key] = nil
+		self.keysByAsset[oldest.asset] = nil
+		self.totalBytes -= oldest.bytes
+		self.stats.evictions += 1
+	end
+end
+
+function AssetManager:setBudget(budget)
+	self.budget = budget or DEFAULT_BUDGET
+	self:trim()
+end
+
+function AssetManager:getBudget()
+	return self.budget
+end
+
+-- Returns the estimated bytes used by all cached assets, and by the assets in use
+function AssetManager:getMemoryUsage()
+	local usedBytes = 0
+	for _, entry in pairs(self.entries) do
+		if entry.refCount > 0 then
+			usedBytes += entry.bytes
+		end
+	end
+	return self.totalBytes, usedBytes
+end
+
+-- Returns a table of cached assets by key, each with its estimated `bytes` and `refCount`
+function AssetManager:getAssetReport()
+	local report = {}
+	for key, entry in pairs(self.entries) do
+		report[key] = { bytes = entry.bytes, refCount = entry.refCount }
+	end
+	return report
+end
+
+-- Returns the cache hits, misses and evictions
+function AssetManager:getStats()
+	local stats = self.stats
+	return stats.hits, stats.misses, stats.evictions
+end
+
+-- ! ASSET LOADER
+-- Loads a manifest's assets one per scheduler slice, using only the spare time at the end of each frame.
+class("RoxyAssetLoader").extends()
+
+function RoxyAssetLoader:init(assetManager, manifest, name)
+	self.assetManager = assetManager
+	self.name = name or "asset manifest"
+	self.items = {}  -- Kind and path pairs, flattened: kind1, path1, kind2, path2, ...
+	self.assets = {}  -- Loaded assets, each holding a reference until `release`
+	self.loadedCount = 0
+	self.job = nil
+	
+	for _, path in ipairs(manifest.images or {}) do
+		table.insert(self.items, "image")
+		table.insert(self.items, path)
+	end
+	for _, path in ipairs(manifest.imagetables or {}) do
+		table.insert(self.items, "imagetable")
+		table.insert(self.items, path)
+	end
+end
+
+function RoxyAssetLoader:start()
+	self.job = schedulerManager:schedule(function()
+		while self:loadNext() do
+			coroutine.yield()
+		end
+	end, LOADER_PRIORITY, "load " .. self.name)
+end
+
+-- Loads the next asset; returns false once everything is loaded
+function RoxyAssetLoader:loadNext()
+	local index = self.loadedCount * 2 + 1
+	local kind, path = self.items[index], self.items[index + 1]
+	if not kind then return false end
+	
+	local asset
+	if kind == "imagetable" then
+		asset = self.assetManager:getImagetable(path)
+	else
+		asset = self.assetManager:getImage(path)
+	end
+	if asset then
+		table.insert(self.assets, asset)
+	end
+	self.loadedCount += 1
+	return not self:isReady()
+end
+
+-- Loads the remaining assets right away, e.g. when there is no animation to load behind
+function RoxyAssetLoader:finish()
+	if self.job then
+		schedulerManager:cancel(self.job)
+		self.job = nil
+	end
+	while self:loadNext() do end
+end
+
+function RoxyAssetLoader:isReady()
+	return self.loadedCount >= #self.items // 2
+end
+
+function RoxyAssetLoader:getTotal()
+	return #self.items // 2
+end
+
+-- Returns the fraction of assets loaded, from 0 to 1
+function RoxyAssetLoader:getProgress()
+	local total = self:getTotal()
+	return total > 0 and self.loadedCount / total or 1
+end
+
+-- Stops loading and releases the loaded assets, which stay cached until evicted
+function RoxyAssetLoader:release()
+	if self.job then
+		schedulerManager:cancel(self.job)
+		self.job = nil
+	end
+	for i = 1, #self.assets do
+		self.assetManager:release(self.assets[i])
+	end
+	self.assets = {}
+end
+
+-- Singleton access method to get the instance of AssetManager
+-- @return The singleton instance of AssetManager
+function AssetManager.getInstance()
+	if not instance then
+		instance = AssetManager()
+	end
+	return instance
+end
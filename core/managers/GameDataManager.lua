@@ -1,6 +1,7 @@
 local MAX_SLOT_LIMIT = 1000  -- Maximum limit for the number of game data slots
 
 local configurationManager <const> = ConfigurationManager.getInstance()
+local schedulerManager <const> = SchedulerManager.getInstance()
 
 local pd <const> = playdate
 local Object <const> = pd.object
@@ -19,6 +20,7 @@ function GameDataManager:init()
 	self.numberOfSlots = 1					-- Current number of active slots
 	self.currentSlot = 1					-- Slot currently in use
 	self.gameDataHasBeenSetup = false		-- Flag to prevent multiple setups
+	self.pendingSaves = {}					-- Deferred save jobs, keyed by slot
 	
 	-- Determine the maximum number of slots allowed, with validation
 	local maxSaveSlots = configurationManager:getConfig().maxSaveSlots
@@ -385,6 +387,19 @@ function GameDataManager:save(gameDataSlot)
 	end
 end
 
+-- Saves the slot from the scheduler once the frame has time left, instead of in the current frame.
+-- Saves of the same slot made before it runs share one job, which writes the latest data.
+function GameDataManager:saveDeferred(gameDataSlot)
+	gameDataSlot = gameDataSlot or self.currentSlot
+	local pendingSave = self.pendingSaves[gameDataSlot]
+	if pendingSave and not pendingSave.isDone then return end  -- A cancelled job never runs, so it's replaced
+	
+	self.pendingSaves[gameDataSlot] = schedulerManager:schedule(function()
+		self.pendingSaves[gameDataSlot] = nil
+		self:save(gameDataSlot)
+	end, 0, "save Game" .. gameDataSlot)
+end
+
 function GameDataManager:saveAll()
 	for i = 1, self.numberOfSlots do
 		Datastore.write(self.gameDatas[i], "Game" .. i)  -- Save all slots to disk
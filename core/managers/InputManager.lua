@@ -7,6 +7,58 @@ local InputHandlers <const> = pd.inputHandlers
 local UI <const> = pd.ui
 local Input <const> = roxy.input
 
+local EVENT_COUNT <const> = Input.EVENT_COUNT
+local SLOT_COUNT <const> = Input.BUTTON_COUNT * EVENT_COUNT
+
+-- Handler callback names, indexed by the button and event constants returned by `roxy.input.poll`
+local buttonNames <const> = {
+	[Input.BUTTON_A] = "A",
+	[Input.BUTTON_B] = "B",
+	[Input.BUTTON_UP] = "up",
+	[Input.BUTTON_DOWN] = "down",
+	[Input.BUTTON_LEFT] = "left",
+	[Input.BUTTON_RIGHT] = "right"
+}
+local eventNames <const> = {
+	[Input.PRESSED] = "ButtonPressed",
+	[Input.RELEASED] = "ButtonReleased",
+	[Input.CUSTOM_HELD] = "ButtonCustomHeld",
+	[Input.PRESSED_CONTINUOUSLY] = "ButtonPressedContinuously"
+}
+
+-- Callback names by slot, where a slot is `(button - 1) * EVENT_COUNT + event`
+local slotNames <const> = {}
+for button, buttonName in pairs(buttonNames) do
+	for event, eventName in pairs(eventNames) do
+		slotNames[(button - 1) * EVENT_COUNT + event] = buttonName .. eventName
+	end
+end
+
+-- Calls the current handler's function for each (button, event) pair, without building a table for them.
+-- The slots are looked up per event, since a callback may change the handler.
+local function dispatchButtonEvents(inputManager, button, event, ...)
+	if not button then return end
+	local callback = inputManager.handlerSlots[(button - 1) * EVENT_COUNT + event]
+	if callback then
+		callback()
+	end
+	return dispatchButtonEvents(inputManager, ...)
+end
+
+-- Calls the function for each completed combo id: the one given to `addCombo`, or the handler's function named after the combo
+local function dispatchCombos(inputManager, id, ...)
+	if not id then return end
+	local callback = inputManager.comboCallbacks[id]
+	if not callback then
+		local handler = inputManager.currentHandler
+		callback = handler and handler[inputManager.comboNames[id]]
+	end
+	if callback then
+		callback()
+	end
+	return dispatchCombos(inputManager, ...)
+end
+
 class("InputManager").extends()
 
 -- Singleton instance for managing inputs globally
@@ -14,20 +66,32 @@ local instance = nil
 
 function InputManager:init()
 	self.currentHandler = nil
+	self.handlerSlots = {}  -- The current handler's button functions, indexed by slot
+	self:refreshHandlerSlots()
 	self.isEnabled = true  -- InputManager starts in an enabled state
 	self.buttonHoldBufferAmount = 3  -- Adjusts sensitivity of hold detection with number of frames
-	self.buttonHoldCounts = {}
 	self.customHoldThreshold = configurationManager:getConfig().customHoldThreshold or 20  -- Sets the frame count threshold for triggering custom hold actions for buttons
 	self.crankIndicatorActive = false
 	self.crankIndicatorForced = false
 	self.defaultCrankDirection = configurationManager:getConfig().crankDirection or 1
 	self.crankDirection = self.defaultCrankDirection
+	self.crankTicked = false  -- The current handler's `crankTicked` and `crankMoved`, resolved with the button slots
+	self.crankMoved = false
+	self.comboIds = {}  -- Native combo ids by name
+	self.comboNames = {}  -- Combo names and callbacks by native combo id
+	self.comboCallbacks = {}
 	
 	self.counter = 0
 
 	-- Set the button hold buffer amount and custom hold threshold in C
 	Input.setButtonHoldBufferAmount(self.buttonHoldBufferAmount)
 	Input.setCustomHoldThreshold(self.customHoldThreshold)
+	
+	-- Set up crank ticks, filtering and direction in C (roxy_crank.c)
+	local config = configurationManager:getConfig()
+	Input.setCrankTicksPerRevolution(config.crankTicksPerRevolution or 6)
+	Input.setCrankSmoothing(config.crankSmoothing or 0.5)
+	Input.setCrankDirection(self.crankDirection)
 end
 
 -- ! Set, Get, and Reset Handler
@@ -36,6 +100,7 @@ function InputManager:setHandler(handler)
 		InputHandlers.pop()
 	end
 	self.currentHandler = handler
+	self:refreshHandlerSlots()
 	self:resetInputState()  -- Ensures the input state is fresh when changing handlers.
 	if handler then
 		InputHandlers.push(handler)
@@ -48,8 +113,21 @@ function InputManager:getHandler()
 	end
 end
 
+-- Resolves the current handler's button functions into the slot array used by `handleInput`.
+-- Called when the handler changes; call it again after adding or replacing functions on the current handler.
+function InputManager:refreshHandlerSlots()
+	local handler = self.currentHandler
+	local slots = self.handlerSlots
+	for slot = 1, SLOT_COUNT do
+		slots[slot] = handler and handler[slotNames[slot]] or false
+	end
+	self.crankTicked = handler and handler.crankTicked or false
+	self.crankMoved = handler and handler.crankMoved or false
+end
+
 function InputManager:resetInputState()
-	self.buttonHoldCounts = {}  -- Resets the count of how long each button has been held.
+	Input.reset()  -- Resets how long each button has been held; the counts used by `roxy.input.poll` live in C
+	Input.resetCombos()
 end
 
 -- ! Saving, Clearing, and Restoring Input Handlers
@@ -71,6 +149,7 @@ function InputManager:clearHandler()
 	if self.currentHandler then
 		InputHandlers.pop()
 		self.currentHandler = nil
+		self:refreshHandlerSlots()
 	end
 	self:resetInputState()
 end
@@ -113,11 +192,13 @@ function InputManager:setCrankDirection(direction)
 	else
 		warn("Invalid crank direction: " .. tostring(direction) .. ". Direction must be either 1 or -1. crankDirection remains: " .. tostring(self.crankDirection))
 	end
+	Input.setCrankDirection(self.crankDirection)
 end
 
 function InputManager:resetCrankDirection()
 	print("resetting the crank direction back to :", self.defaultCrankDirection)
 	self.crankDirection = self.defaultCrankDirection
+	Input.setCrankDirection(self.crankDirection)
 end
 
 -- ! Crank Docked
@@ -133,31 +214,135 @@ function InputManager:crankUndocked()
 	end
 end
 
+-- ! Crank State
+-- Returns the crank angle, accumulated angle since the last reset, filtered velocity and acceleration, and whether it is docked
+function InputManager:getCrankState()
+	return Input.getCrankState()
+end
+
+function InputManager:resetCrank()
+	Input.resetCrank()
+end
+
+-- ! Combos
+-- Registers a button combo or gesture, matched in C (roxy_combo.c) each frame. Steps are separated by spaces,
+-- and buttons pressed together by '+': "down down+right right+A". "A A" is a double tap, "A~30" holds A for
+-- 30 frames, and "^A" releases A. `window` is the frames allowed between steps (default 10).
+-- On a match, `callback` is called, or else the current handler's function named `name`.
+function InputManager:addCombo(name, pattern, window, callback)
+	self:removeCombo(name)
+	
+	local id = Input.addCombo(pattern, window)
+	if not id then
+		warn("Warning: Invalid input combo '" .. tostring(name) .. "': " .. tostring(pattern))
+		return false
+	end
+	self.comboIds[name] = id
+	self.comboNames[id] = name
+	self.comboCallbacks[id] = callback or false
+	return true
+end
+
+function InputManager:removeCombo(name)
+	local id = self.comboIds[name]
+	if id then
+		Input.removeCombo(id)
+		self.comboIds[name] = nil
+		self.comboNames[id] = nil
+		self.comboCallbacks[id] = nil
+	end
+end
+
+function InputManager:clearCombos()
+	Input.clearCombos()
+	self.comboIds = {}
+	self.comboNames = {}
+	self.comboCallbacks = {}
+end
+
+-- ! Record and Replay
+-- Input is recorded into a native ring buffer (roxy_input_recorder.c), once per frame, with its frame index and time.
+-- Replaying feeds it back to `handleInput` in place of the device's input, for deterministic runs.
+function InputManager:startRecording(capacity)
+	return Input.startRecording(capacity)
+end
+
+function InputManager:stopRecording()
+	Input.stopRecording()
+end
+
+function InputManager:isRecording()
+	return Input.isRecording()
+end
+
+-- Saves the recording to the game's Data folder
+function InputManager:saveRecording(path)
+	return Input.saveRecording(path)
+end
+
+function InputManager:loadRecording(path)
+	return Input.loadRecording(path)
+end
+
+-- Replays the current recording, or the one loaded from `path`
+function InputManager:startReplay(path)
+	if path and not Input.loadRecording(path) then
+		return false
+	end
+	
+	-- Start from the same state as the recording did
+	self:resetInputState()
+	Input.resetCrank()
+	return Input.startReplay()
+end
+
+function InputManager:stopReplay()
+	Input.stopReplay()
+	self:resetInputState()
+end
+
+function InputManager:isReplaying()
+	return Input.isReplaying()
+end
+
+-- Returns the number of records, frames covered, and seconds between the first and last record
+function InputManager:getRecordingInfo()
+	return Input.getRecordingInfo()
+end
+
 -- ! Handle Input
 -- Processes all button inputs and handles their state changes and hold actions
-function InputManager:handleInput()
+function InputManager:handleInput(deltaTime)
+	-- Sample the frame's buttons and crank once, from the device or a replay, recording them if enabled
+	Input.beginFrame()
+	
+	-- The crank is updated every frame so its velocity stays current, even without a handler
+	local ticks, change, velocity, acceleration = Input.updateCrank(deltaTime or 0)
+	
 	-- Checks if there is a current handler and if the input manager is enabled
 	if not self.currentHandler or not self.isEnabled then return end
 
-	-- Define a list of button-specific processing functions
-	local buttonFunctions = {
-		Input.processButtonA,
-		Input.processButtonB,
-		Input.processButtonUp,
-		Input.processButtonDown,
-		Input.processButtonLeft,
-		Input.processButtonRight
-	}
-
-	-- Iterate through each button-specific function and process the callback
-	for i = 1, #buttonFunctions do
-		local callback = buttonFunctions[i]()
-
-		-- Call the appropriate function on the current handler if it exists
-		if callback and callback ~= "" and self.currentHandler and self.currentHandler[callback] then
-			self.currentHandler[callback]()
-		end
+	-- Reads every button in one call (roxy_input.c) and calls the matching handler functions
+	dispatchButtonEvents(self, Input.poll())
+	
+	-- Calls the handler's crank functions, with ticks and changes already in the crank direction
+	if ticks ~= 0 and self.crankTicked then
+		self.crankTicked(ticks)
 	end
+	if change ~= 0 and self.crankMoved then
+		self.crankMoved(change, velocity, acceleration)
+	end
+	
+	-- Advances the registered combos in C and calls the ones completed this frame
+	local hasMoreMatches = self:dispatchCombos(Input.updateCombos())
+	while hasMoreMatches do
+		hasMoreMatches = self:dispatchCombos(Input.popCombos())
+	end
+end
+
+function InputManager:dispatchCombos(hasMoreMatches, ...)
+	dispatchCombos(self, ...)
+	return hasMoreMatches
 end
 
 -- ! Get and Set isEnabled
@@ -3,6 +3,12 @@ local Object <const> = pd.object
 local Graphics <const> = pd.graphics
 local Sprite <const> = Graphics.sprite
 
+-- Paths of the shared scene images, loaded on first use through the asset manager
+local imagePaths <const> = {
+	background1 = "libraries/roxy/assets/images/background1",
+	background2 = "libraries/roxy/assets/images/background2"
+}
+
 class("SceneManager").extends()
 
 -- Singleton instance for managing scenes globally
@@ -11,21 +17,6 @@ local instance = nil
 function SceneManager:init()
 	self.scenes = {}
 	self.currentScene = nil
-	self.pools = {  -- Object pools to optimize resource management
-		images = {
-			background1 = {},
-			background2 = {}
-		}
-	}
-	self:populatePools(4)  -- Initialize object pools with default size
-end
-
-function SceneManager:populatePools(poolSize)
-	-- Preload images into the object pools to optimize memory usage and reduce load times
-	for i = 1, poolSize or 1 do
-		self:recycleImage("background1", Graphics.image.new("libraries/roxy/assets/images/background1"))
-		self:recycleImage("background2", Graphics.image.new("libraries/roxy/assets/images/background2"))
-	end
 end
 
 function SceneManager:registerScenes(...)
@@ -76,30 +67,19 @@ function SceneManager:setCurrentScene(scene)
 	end
 end
 
--- ! Object Pool Methods
+-- ! Shared Images
+-- Scene images are shared through the asset manager: `getImage` adds a reference and `recycleImage` removes it
 function SceneManager:getImage(type)
-	local imagePool = self.pools.images
-	-- Retrieve an image from the corresponding pool, if available
-	if type == "background1" and #imagePool.background1 > 0 then
-		return table.remove(imagePool.background1)
-	elseif type == "background2" and #imagePool.background2 > 0 then
-		return table.remove(imagePool.background2)
-	else
+	local path = imagePaths[type]
+	if not path then
 		warn("Warning: No image available for type: " .. tostring(type))
 		return nil
 	end
+	return AssetManager.getInstance():getImage(path)
 end
 
 function SceneManager:recycleImage(type, image)
-	local imagePool = self.pools.images
-	-- Return the image to the appropriate pool for reuse
-	if type == "background1" then
-		table.insert(imagePool.background1, image)
-	elseif type == "background2" then
-		table.insert(imagePool.background2, image)
-	else
-		warn("Warning: Invalid image type: " .. tostring(type))
-	end
+	AssetManager.getInstance():release(image)
 end
 
 -- Singleton access method to get the instance of SceneManager
@@ -0,0 +1,163 @@
+local configurationManager <const> = ConfigurationManager.getInstance()
+
+local pd <const> = playdate
+local Object <const> = pd.object
+
+-- Priority added per frame a job waits, so low-priority jobs eventually run
+local AGING_PER_FRAME <const> = 1
+
+class("SchedulerManager").extends()
+
+-- Singleton instance for managing deferred work globally
+local instance = nil
+
+-- Runs deferred jobs at the end of `Roxy:update`, only while time is left in the frame budget.
+-- A job is a function or a coroutine; functions run as coroutines, so long jobs can
+-- `coroutine.yield()` to continue in a later frame. The frame time is read from
+-- `pd.getElapsedTime()`, which Roxy resets at the start of each frame.
+function SchedulerManager:init()
+	SchedulerManager.super.init(self)
+
+	local config = configurationManager:getConfig()
+	self.jobs = {}  -- Pending jobs, in the order they were scheduled
+	self.frameReserve = config.schedulerFrameReserve or 0.002  -- Seconds of the frame budget left unused
+	self.maxWaitFrames = config.schedulerMaxWaitFrames or 30  -- Frames a job can wait before it runs regardless of the budget
+	self.nextJobId = 1
+	self.frame = 0  -- Frames run, used to skip jobs that already ran this frame
+end
+
+-- ! Schedule and Cancel
+-- Adds a job and returns it. Higher priorities run first; the default is 0.
+-- The returned job records `totalTime`, `lastTime` and `runs` for time accounting.
+function SchedulerManager:schedule(job, priority, name)
+	local routine = job
+	if type(job) == "function" then
+		routine = coroutine.create(job)
+	elseif type(job) ~= "thread" then
+		error("ERROR: Scheduled jobs must be functions or coroutines.")
+	end
+
+	local scheduledJob = {
+		id = self.nextJobId,
+		name = name or ("job " .. self.nextJobId),
+		routine = routine,
+		priority = priority or 0,
+		waitingFrames = 0,	-- Frames since the job last ran
+		lastRunFrame = -1,
+		totalTime = 0,		-- Seconds spent in the job so far
+		lastTime = 0,		-- Seconds spent in its last slice, used to estimate the next one
+		runs = 0,			-- Number of slices run
+		isDone = false
+	}
+	self.nextJobId += 1
+	table.insert(self.jobs, scheduledJob)
+	return scheduledJob
+end
+
+function SchedulerManager:cancel(job)
+	for i = #self.jobs, 1, -1 do
+		if self.jobs[i] == job then
+			table.remove(self.jobs, i)
+			job.isDone = true
+			return true
+		end
+	end
+	return false
+end
+
+function SchedulerManager:cancelAll()
+	for i = 1, #self.jobs do
+		self.jobs[i].isDone = true
+	end
+	self.jobs = {}
+end
+
+function SchedulerManager:getJobCount()
+	return #self.jobs
+end
+
+-- ! Run
+-- Returns the index of the waiting job with the highest priority, aged by the frames it has waited
+local function findNextJob(jobs, frame)
+	local bestIndex, bestPriority = nil, nil
+	for i = 1, #jobs do
+		local job = jobs[i]
+		if job.lastRunFrame ~= frame then
+			local priority = job.priority + job.waitingFrames * AGING_PER_FRAME
+			if not bestPriority or priority > bestPriority then
+				bestIndex, bestPriority = i, priority
+			end
+		end
+	end
+	return bestIndex
+end
+
+-- Runs one slice of a job and updates its time accounting. Returns whether the job finished.
+local function runSlice(job)
+	local startTime = pd.getElapsedTime()
+	local success, errorMessage = coroutine.resume(job.routine)
+	local sliceTime = pd.getElapsedTime() - startTime
+
+	job.lastTime = sliceTime
+	job.totalTime += sliceTime
+	job.runs += 1
+	job.waitingFrames = 0
+
+	if not success then
+		warn("Warning: Scheduled job '" .. job.name .. "' failed: " .. tostring(errorMessage))
+		return true
+	end
+	return coroutine.status(job.routine) == "dead"
+end
+
+-- Called once per frame, after the frame's own work
+function SchedulerManager:run()
+	local jobs = self.jobs
+	if #jobs == 0 then return end
+
+	local budget = 1 / roxy.graphics.getRefreshRate() - self.frameReserve
+	local frame = self.frame + 1
+	self.frame = frame
+	local forcedRun = false  -- Only one starving job may go over the budget per frame
+
+	while true do
+		local index = findNextJob(jobs, frame)
+		if not index then break end
+
+		local job = jobs[index]
+		local remaining = budget - pd.getElapsedTime()
+		local isStarving = job.waitingFrames >= self.maxWaitFrames
+
+		-- Run the job if its last slice fits in the time left, or once it has waited too long
+		if remaining > 0 and job.lastTime <= remaining then
+			-- Fits the budget
+		elseif isStarving and not forcedRun then
+			forcedRun = true
+		else
+			break
+		end
+
+		job.lastRunFrame = frame
+		if runSlice(job) then
+			job.isDone = true
+			table.remove(jobs, index)
+		end
+	end
+
+	-- Jobs that didn't get a slice this frame move up in priority
+	for i = 1, #jobs do
+		local job = jobs[i]
+		if job.lastRunFrame ~= frame then
+			job.waitingFrames += 1
+		end
+	end
+end
+
+-- Singleton access method to get the instance of SchedulerManager
+-- @return The singleton instance of SchedulerManager
+function SchedulerManager.getInstance()
+	if not instance then
+		instance = SchedulerManager()
+	end
+	return instance
+end
@@ -5,63 +5,199 @@
 
 local pd <const> = playdate
 local Object <const> = pd.object
+local Sequence <const> = roxy.sequence
+
+-- Event reported by the native pool when a sequence finishes, matching `ROXY_SEQUENCE_EVENT_FINISHED`
+local EVENT_FINISHED <const> = 0
 
 class("SequenceManager").extends()
 
 -- Singleton instance for managing sequences globally
 local instance = nil
 
+-- Easing capacity reserved in the native storage of pooled sequences
+local DEFAULT_EASING_CAPACITY <const> = 16
+
 function SequenceManager:init()
 	SequenceManager.super.init(self)
-	self.runningSequences = {}  -- Table to hold all currently running sequences
+	-- Currently running sequences, keyed by native sequence id.
+	-- Their time is advanced in C by the native sequence pool (roxy_sequence.c).
+	self.runningSequences = {}
+	
+	-- Object pool of cleared sequences available to `acquire`
+	self.freeSequences = {}
+	self.easingCapacity = DEFAULT_EASING_CAPACITY
+	self.ownedSequences = setmetatable({}, { __mode = "k" })  -- Owner -> set of acquired sequences
+	self.poolStats = {
+		hits = 0,		-- Acquires served from the pool
+		misses = 0,		-- Acquires that had to create a new sequence
+		releases = 0	-- Sequences returned to the pool
+	}
+end
+
+-- ! Sequence Pool
+-- Preallocates sequences with reserved easing capacity; called from `Roxy:new` with the
+-- `sequencePoolSize` and `sequencePoolEasingCapacity` configuration values.
+-- When `deferred` is true, the sequences are created by the scheduler, one per slice of spare frame time.
+function SequenceManager:populatePool(poolSize, easingCapacity, deferred)
+	self.easingCapacity = easingCapacity or self.easingCapacity
+	Sequence.reservePool(poolSize or 1)  -- Room in the native pool of running sequences
+	
+	local function populate()
+		for i = 1, poolSize or 1 do
+			local sequence = RoxySequence()
+			sequence.native:reserve(self.easingCapacity)
+			sequence.isPooled = true
+			table.insert(self.freeSequences, sequence)
+			if deferred then
+				coroutine.yield()
+			end
+		end
+	end
+	
+	if deferred then
+		SchedulerManager.getInstance():schedule(populate, -1, "populate sequence pool")
+	else
+		populate()
+	end
+end
+
+-- Returns a cleared sequence from the pool, or a new one if the pool is empty.
+-- When an owner (e.g. a scene) is given, `releaseAll(owner)` returns the sequence to the pool.
+function SequenceManager:acquire(owner)
+	local sequence = table.remove(self.freeSequences)
+	if sequence then
+		self.poolStats.hits += 1
+		sequence.isPooled = false
+	else
+		self.poolStats.misses += 1
+		sequence = RoxySequence()
+		sequence.native:reserve(self.easingCapacity)
+	end
+	
+	if owner then
+		local owned = self.ownedSequences[owner]
+		if not owned then
+			owned = {}
+			self.ownedSequences[owner] = owned
+		end
+		owned[sequence] = true
+		sequence.poolOwner = owner
+	end
+	
+	return sequence
+end
+
+-- Stops and clears a sequence, then returns it to the pool
+function SequenceManager:release(sequence)
+	if not sequence or sequence.isPooled then return end
+	
+	local owner = sequence.poolOwner
+	if owner then
+		local owned = self.ownedSequences[owner]
+		if owned then
+			owned[sequence] = nil
+		end
+		sequence.poolOwner = nil
+	end
+	
+	sequence:clear()  -- Stops the sequence; the native easing storage is kept for reuse
+	sequence:setPacing(1)  -- The next owner starts at normal speed
+	sequence.isPooled = true
+	self.poolStats.releases += 1
+	table.insert(self.freeSequences, sequence)
+end
+
+-- Returns every sequence acquired by an owner to the pool
+function SequenceManager:releaseAll(owner)
+	local owned = self.ownedSequences[owner]
+	if not owned then return end
+	
+	self.ownedSequences[owner] = nil
+	for sequence in pairs(owned) do
+		sequence.poolOwner = nil
+		self:release(sequence)
+	end
+end
+
+-- Returns the pool hits, misses and releases, and the number of sequences currently available
+function SequenceManager:getPoolStats()
+	local stats = self.poolStats
+	return stats.hits, stats.misses, stats.releases, #self.freeSequences
+end
+
+function SequenceManager:resetPoolStats()
+	local stats = self.poolStats
+	stats.hits = 0
+	stats.misses = 0
+	stats.releases = 0
 end
 
 -- ! Add and Remove Sequence
 function SequenceManager:add(sequence)
-	-- Add a sequence to the list of running sequences
-	table.insert(self.runningSequences, sequence)
+	-- Add a sequence to the running sequences and the native pool
+	self.runningSequences[sequence.id] = sequence
+	sequence.native:start()
 end
 
 function SequenceManager:remove(sequenceToRemove)
-	-- Remove a specific sequence from the list of running sequences
-	for i = #self.runningSequences, 1, -1 do
-		if self.runningSequences[i] == sequenceToRemove then
-			table.remove(self.runningSequences, i)
-			break  -- Exit the loop once the sequence is found and removed
-		end
-	end
+	-- Remove a specific sequence from the running sequences; the native pool swap-removes it
+	self.runningSequences[sequenceToRemove.id] = nil
+	sequenceToRemove.native:stop()
 end
 
 function SequenceManager:removeAll()
-	-- Remove all sequences from the list of running sequences
-	for i = #self.runningSequences, 1, -1 do
-		table.remove(self.runningSequences, i)
-	end
+	-- Remove all sequences from the running sequences
+	Sequence.stopAll()
+	self.runningSequences = {}
 end
 
 -- ! Stop All Sequences
 function SequenceManager:stopAll()
 	-- Stop all running sequences and then remove them from the list
-	for i = #self.runningSequences, 1, -1 do
-		local sequence = self.runningSequences[i]
+	for _, sequence in pairs(self.runningSequences) do
 		sequence:stop()  -- Call the stop method on each sequence
 	end
 end
 
 -- ! Update
-function SequenceManager:update(deltaTime)
-	local runningSequences = self.runningSequences
-	-- Iterate through all running sequences, updating each one
-	for i = #runningSequences, 1, -1 do
-		local sequence = runningSequences[i]
-		
-		sequence:update(deltaTime)  -- Update the sequence with the current delta time
-		
-		-- If the sequence is done, remove it from the list
-		if sequence:isDone() then
-			self:remove(sequence)
+
+-- Handles (id, event) pairs returned by the native pool. Callbacks of a sequence come before
+-- its finished event, so a callback can restart its own sequence.
+local function dispatchEvents(runningSequences, id, event, ...)
+	if not id then return end
+	
+	local sequence = runningSequences[id]
+	if sequence then
+		if event == EVENT_FINISHED then
+			if not sequence.native:isRunning() then
+				runningSequences[id] = nil
+			end
+		else
+			sequence:invokeCallback(event)
 		end
 	end
+	
+	return dispatchEvents(runningSequences, ...)
+end
+
+function SequenceManager:update(deltaTime)
+	-- Advance every running sequence in one native pass; only fired callbacks and
+	-- finished sequences come back to Lua
+	local hasMoreEvents = self:dispatch(Sequence.updateAll(deltaTime))
+	while hasMoreEvents do
+		hasMoreEvents = self:dispatch(Sequence.popEvents())
+	end
+end
+
+function SequenceManager:dispatch(hasMoreEvents, ...)
+	dispatchEvents(self.runningSequences, ...)
+	return hasMoreEvents
+end
+
+-- ! Get Running Count
+function SequenceManager:getRunningCount()
+	return Sequence.getRunningCount()
 end
 
 -- Singleton access method to get the instance of SequenceManager
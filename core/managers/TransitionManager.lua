@@ -2,14 +2,36 @@ local configurationManager <const> = ConfigurationManager.getInstance()
 local sequenceManager <const> = SequenceManager.getInstance()
 local sceneManager <const> = SceneManager.getInstance()
 local inputManager <const> = InputManager.getInstance()
+local assetManager <const> = AssetManager.getInstance()
 
 local pd <const> = playdate
 local Object <const> = pd.object
 local Graphics <const> = pd.graphics
 local Timer <const> = pd.timer
+local Sprite <const> = Graphics.sprite
+local RoxyGraphics <const> = roxy.graphics
 
 local displayWidth, displayHeight, displayCenterX, displayCenterY = roxy.graphics.getDisplaySize()
 
+-- Shared transition assets by type, loaded on first use through the asset manager
+local imagetablePaths <const> = {
+	imagetable = "libraries/roxy/assets/images/SLOTHUniversalLeaderEnter",
+	imagetableEnter = "libraries/roxy/assets/images/SLOTHUniversalLeaderEnter",
+	imagetableExit = "libraries/roxy/assets/images/SLOTHUniversalLeaderExit"
+}
+local panelColors <const> = {
+	panelImage = Graphics.kColorBlack,
+	panelImageBlack = Graphics.kColorBlack,
+	panelImageWhite = Graphics.kColorWhite
+}
+local ditherTypes <const> = {
+	bayer8x8 = Graphics.image.kDitherTypeBayer8x8
+}
+
+-- Capture surfaces, allocated once and reused by every transition
+local CAPTURE_OUTGOING <const> = 1  -- The last frame of the outgoing scene
+local CAPTURE_INCOMING <const> = 2  -- The incoming scene, captured each frame
+
 class("TransitionManager").extends()
 
 -- Singleton instance for managing transitions globally
@@ -19,35 +41,8 @@ function TransitionManager:init()
 	self.transitions = {}
 	self.currentTransition = nil
 	self.isTransitioning = false
-	self.pools = {  -- Object pools to optimize resource management
-		imagetables = {
-			imagetable = {},
-			imagetableEnter = {},
-			imagetableExit = {}
-		},
-		images = {
-			panelImageBlack = {},
-			panelImageWhite = {}
-		},
-		ditherPatterns = {
-			bayer8x8 = {}
-		},
-		sequences = {}
-	}
-	self:populatePools(3)  -- Initialize pools with default size
-end
-
-function TransitionManager:populatePools(poolSize)
-	-- Preload objects into the pools to optimize performance and reduce load times
-	for i = 1, poolSize or 1 do
-		self:recycleImagetable("imagetable", Graphics.imagetable.new("libraries/roxy/assets/images/SLOTHUniversalLeaderEnter"))
-		self:recycleImagetable("imagetableEnter", Graphics.imagetable.new("libraries/roxy/assets/images/SLOTHUniversalLeaderEnter"))
-		self:recycleImagetable("imagetableExit", Graphics.imagetable.new("libraries/roxy/assets/images/SLOTHUniversalLeaderExit"))
-		self:recycleImage("panelImageBlack", Graphics.image.new(displayWidth, displayHeight, Graphics.kColorBlack))
-		self:recycleImage("panelImageWhite", Graphics.image.new(displayWidth, displayHeight, Graphics.kColorWhite))
-		self:recycleDither("bayer8x8", Graphics.image.kDitherTypeBayer8x8)
-		self:recycleSequence(RoxySequence())
-	end
+	self.preloads = {}  -- Asset loaders started by `preloadScene`, by scene class
+	self.captureSurfaces = {}  -- Display-sized images, created on first use
 end
 
 -- ! Load Transitions
@@ -78,10 +73,18 @@ function TransitionManager:transitionToScene(newSceneClass, transitionName, dura
 	
 	self.isTransitioning = true
 	
-	local newScene = newSceneClass()
-	-- Validate the new scene object
-	if not newScene then
-		error("ERROR: newScene is not properly instantiated or missing methods.")
+	-- Load the scene's asset manifest in the background while the transition plays.
+	-- A scene with a manifest is created at the midpoint, once its assets are loaded.
+	local assetLoader = self.preloads[newSceneClass] or assetManager:loadManifest(newSceneClass.assets, newSceneClass.className)
+	self.preloads[newSceneClass] = nil
+	
+	local newScene = nil
+	if not assetLoader then
+		newScene = newSceneClass()
+		-- Validate the new scene object
+		if not newScene then
+			error("ERROR: newScene is not properly instantiated or missing methods.")
+		end
 	end
 	
 	local currentScene = sceneManager:getCurrentScene() or nil
@@ -95,17 +98,81 @@ function TransitionManager:transitionToScene(newSceneClass, transitionName, dura
 	
 	-- Create the transition instance and execute it
 	self.currentTransition = transition(duration, holdTime, properties)
-	self.currentTransition:execute(newScene, currentScene)
+	self.currentTransition:execute(newScene, currentScene, assetLoader, newSceneClass)
+end
+
+-- ! Preload Scene Assets
+-- Starts loading a scene's asset manifest ahead of its transition, e.g. while a menu is open
+function TransitionManager:preloadScene(sceneClass)
+	if not self.preloads[sceneClass] then
+		self.preloads[sceneClass] = assetManager:loadManifest(sceneClass.assets, sceneClass.className)
+	end
+end
+
+function TransitionManager:cancelPreload(sceneClass)
+	local assetLoader = self.preloads[sceneClass]
+	if assetLoader then
+		assetLoader:release()
+		self.preloads[sceneClass] = nil
+	end
+end
+
+-- Returns the fraction of the next scene's assets loaded, from 0 to 1, for drawing a loading indicator
+function TransitionManager:getLoadingProgress()
+	local assetLoader = self.currentTransition and self.currentTransition.assetLoader
+	return assetLoader and assetLoader:getProgress() or 1
+end
+
+-- ! Update the Transition
+-- Holds a transition at its midpoint until the new scene's assets are loaded
+function TransitionManager:update()
+	local currentTransition = self.currentTransition
+	if currentTransition and currentTransition.isWaitingForAssets then
+		currentTransition:updateWaitingForAssets()
+	end
+end
+
+-- ! Capture Surfaces
+-- Transitions capture scenes into a pair of persistent display-sized images instead of allocating new ones.
+-- The frame buffer rows are copied into them in C (roxy_graphics.c).
+function TransitionManager:getCaptureSurface(index)
+	local surface = self.captureSurfaces[index]
+	if not surface then
+		surface = Graphics.image.new(displayWidth, displayHeight, Graphics.kColorWhite)
+		self.captureSurfaces[index] = surface
+	end
+	return surface
+end
+
+-- Copies the last frame sent to the display, i.e. the outgoing scene, and returns the capture.
+-- The capture is overwritten by the next transition, so it is only valid until the current one ends.
+function TransitionManager:captureDisplay()
+	local surface = self:getCaptureSurface(CAPTURE_OUTGOING)
+	roxy.graphics.captureDisplay(surface)
+	return surface
 end
 
--- Prepares the transition screenshot if needed
+-- The incoming scene is drawn to the frame buffer and copied from there, so it is already on screen under the
+-- transition. Transitions that capture it must cover the whole screen, e.g. by drawing `newSceneScreenshot`
+-- over a cleared area, rather than relying on the scene being drawn off-screen.
+
+-- Marks the whole screen dirty before the sprites update. `Sprite.update` only repaints dirty rects, so
+-- without it the capture would keep the previous frame's transition pixels wherever nothing moved.
 function TransitionManager:prepareTransitionScreenshot()
-	if not self.currentTransition then
+	Sprite.addDirtyRect(0, 0, displayWidth, displayHeight)
+end
+
+-- Copies the frame drawn so far, i.e. the incoming scene before the transition draws over it,
+-- into the transition's `newSceneScreenshot`
+function TransitionManager:captureTransitionScreenshot()
+	local currentTransition = self.currentTransition
+	if not currentTransition then
 		return
 	end
 	
-	self.currentTransition.newSceneScreenshot = Graphics.image.new(displayWidth, displayHeight)
-	Graphics.pushContext(self.currentTransition.newSceneScreenshot)  -- Push context for capturing the screenshot
+	local surface = self:getCaptureSurface(CAPTURE_INCOMING)
+	roxy.graphics.captureFrame(surface)
+	currentTransition.newSceneScreenshot = surface
 end
 
 -- ! Draw the Transition
@@ -116,10 +183,6 @@ function TransitionManager:executeTransitionDrawing()
 	end
 
 	local currentTransition = self.currentTransition
-	if currentTransition.captureScreenshotsDuringTransition then
-		Graphics.popContext()  -- Pop context after capturing the screenshot
-	end
-	
 	local drawMode = currentTransition.drawMode or Graphics.kDrawModeCopy  -- Ensure drawMode is valid
 	Graphics.setImageDrawMode(drawMode)
 	currentTransition:draw()
@@ -140,101 +203,73 @@ function TransitionManager:setIsTransitioning(_isTransitioning)
 	end
 end
 
--- ! Object Pool Methods
+-- ! Shared Assets
+-- Transition images are shared through the asset manager: `get` adds a reference and `recycle` removes it.
 
 -- Image tables
 function TransitionManager:getImagetable(type)
-	-- Retrieve an imagetable from the pool based on its type
-	local imagetablePool = self.pools.imagetables
-	if type == "imagetable" and #imagetablePool.imagetable > 0 then
-		return table.remove(imagetablePool.imagetable)
-	elseif type == "imagetableEnter" and #imagetablePool.imagetableEnter > 0 then
-		return table.remove(imagetablePool.imagetableEnter)
-	elseif type == "imagetableExit" and #imagetablePool.imagetableExit > 0 then
-		return table.remove(imagetablePool.imagetableExit)
-	else
+	local path = imagetablePaths[type]
+	if not path then
 		warn("Warning: No imagetable available for type: " .. tostring(type))
 		return nil
 	end
+	return assetManager:getImagetable(path)
 end
 
 function TransitionManager:recycleImagetable(type, imagetable)
-	-- Return an imagetable to the appropriate pool for reuse
-	local imagetablePool = self.pools.imagetables
-	if type == "imagetable" then
-		table.insert(imagetablePool.imagetable, imagetable)
-	elseif type == "imagetableEnter" then
-		table.insert(imagetablePool.imagetableEnter, imagetable)
-	elseif type == "imagetableExit" then
-		table.insert(imagetablePool.imagetableExit, imagetable)
-	else
-		warn("Invalid imagetable type: " .. tostring(type))
-	end
+	assetManager:release(imagetable)
 end
 
 -- Images
 function TransitionManager:getImage(type)
-	-- Retrieve an image from the pool based on its type
-	local imagePool = self.pools.images
-	if type == "panelImageBlack" and #imagePool.panelImageBlack > 0 then
-		return table.remove(imagePool.panelImageBlack)
-	elseif type == "panelImageWhite" and #imagePool.panelImageWhite > 0 then
-		return table.remove(imagePool.panelImageWhite)
-	else
+	local color = panelColors[type]
+	if not color then
 		warn("Warning: No image available for type: " .. tostring(type))
 		return nil
 	end
+	return assetManager:getSolidImage(displayWidth, displayHeight, color)
 end
 
 function TransitionManager:recycleImage(type, image)
-	-- Return an image to the appropriate pool for reuse
-	local imagePool = self.pools.images
-	if type == "panelImageBlack" then
-		table.insert(imagePool.panelImageBlack, image)
-	elseif type == "panelImageWhite" then
-		table.insert(imagePool.panelImageWhite, image)
-	else
-		warn("Warning: Invalid image type: " .. tostring(type))
+	assetManager:release(image)
+end
+
+-- ! Fade Panels
+-- Solid panels don't need an image to fade: each of the 64 dither levels is a cached 8x8 pattern,
+-- built once in C (roxy_graphics.c) and shared by every cover transition, and the panel is filled with
+-- its current level straight in the frame buffer
+function TransitionManager:hasFadePanel(type)
+	return panelColors[type] ~= nil
+end
+
+function TransitionManager:drawFadePanel(type, x, y, alpha, ditherId)
+	local color = panelColors[type]
+	if color then
+		RoxyGraphics.fillDithered(x, y, displayWidth, displayHeight, color, alpha, ditherId)
 	end
 end
 
--- Dither patterns
+-- Dither patterns are SDK constants, so there is nothing to share or recycle
 function TransitionManager:getDither(type)
-	-- Retrieve a dither pattern from the pool based on its type
-	local ditherPool = self.pools.ditherPatterns
-	if type == "bayer8x8" and #ditherPool.bayer8x8 > 0 then
-		return table.remove(ditherPool.bayer8x8)
-	else
+	local ditherType = ditherTypes[type]
+	if not ditherType then
 		warn("Warning: No dither pattern available for type: " .. tostring(type))
-		return nil
 	end
+	return ditherType
 end
 
 function TransitionManager:recycleDither(type, ditherPattern)
-	-- Return a dither pattern to the appropriate pool for reuse
-	local ditherPool = self.pools.ditherPatterns
-	if type == "bayer8x8" then
-		table.insert(ditherPool.bayer8x8, ditherPattern)
-	else
-		warn("Warning: Invalid dither pattern type: " .. tostring(type))
-	end
 end
 
 -- Sequences
 function TransitionManager:getSequence()
-	-- Retrieve a sequence from the pool, or create a new one if the pool is empty
-	local sequencePool = self.pools.sequences
-	if #sequencePool > 0 then
-		return table.remove(sequencePool)
-	else
-		return RoxySequence()
-	end
+	-- Retrieve a sequence from the engine-wide sequence pool
+	return sequenceManager:acquire(self)
 end
 
 function TransitionManager:recycleSequence(sequence)
-	-- Reset and return a sequence to the pool for reuse
-	sequence:clear()
-	table.insert(self.pools.sequences, sequence)
+	-- Reset and return a sequence to the engine-wide sequence pool for reuse
+	sequenceManager:release(sequence)
 end
 
 -- Singleton access method to get the instance of TransitionManager
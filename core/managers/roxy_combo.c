@@ -0,0 +1,322 @@
+#include "roxy_combo.h"
+#include "roxy_input_recorder.h"
+#include <ctype.h>
+
+static PlaydateAPI* pd = NULL;
+
+typedef struct {
+	PDButtons buttons;
+	RoxyComboStepKind kind;
+	int holdFrames;
+} RoxyComboStep;
+
+typedef struct {
+	int isActive;
+	RoxyComboStep steps[ROXY_COMBO_MAX_STEPS];
+	int stepCount;
+	int window;
+	// Partial matches in progress, one bit per next step to match. Several are tracked at once so that
+	// a partial match that fails doesn't hide a later one, e.g. "A A A B" still matches "A A B".
+	uint32_t partialSteps;
+	uint32_t stepFrames[ROXY_COMBO_MAX_STEPS];  // Frame the step before each partial match's next step matched on
+} RoxyCombo;
+
+static RoxyCombo combos[ROXY_COMBO_MAX_COMBOS];
+static int heldFrames[6];  // Frames each button has been held, in the order of buttonNames
+static uint32_t frame = 0;
+
+// Combo ids completed by the last update, returned to Lua a page at a time
+static int matches[ROXY_COMBO_MAX_COMBOS];
+static int matchCount = 0;
+static int matchReadIndex = 0;
+
+static const struct {
+	const char* name;
+	PDButtons button;
+} buttonNames[] = {
+	{ "A", kButtonA },
+	{ "B", kButtonB },
+	{ "up", kButtonUp },
+	{ "down", kButtonDown },
+	{ "left", kButtonLeft },
+	{ "right", kButtonRight }
+};
+#define NUM_BUTTONS (sizeof(buttonNames) / sizeof(buttonNames[0]))
+
+void roxy_combo_setPlaydateAPI(PlaydateAPI* playdate) {
+	pd = playdate;
+}
+
+// ! Compile
+
+static int matchesName(const char* text, int length, const char* name) {
+	for (int i = 0; i < length; ++i) {
+		if (name[i] == '\0' || tolower((unsigned char)text[i]) != tolower((unsigned char)name[i])) {
+			return 0;
+		}
+	}
+	return name[length] == '\0';
+}
+
+// Parses one step, e.g. "down+right", "^A" or "A~30". Returns 0 if it isn't valid.
+static int parseStep(const char* text, int length, RoxyComboStep* outStep) {
+	outStep->buttons = 0;
+	outStep->kind = kRoxyComboPress;
+	outStep->holdFrames = 0;
+	
+	if (length > 0 && text[0] == '^') {
+		outStep->kind = kRoxyComboRelease;
+		++text;
+		--length;
+	}
+	
+	int start = 0;
+	for (int i = 0; i <= length; ++i) {
+		if (i < length && text[i] != '+' && text[i] != '~') {
+			continue;
+		}
+		
+		PDButtons button = 0;
+		for (int j = 0; j < (int)NUM_BUTTONS; ++j) {
+			if (matchesName(text + start, i - start, buttonNames[j].name)) {
+				button = buttonNames[j].button;
+			}
+		}
+		if (button == 0) {
+			return 0;
+		}
+		outStep->buttons |= button;
+		
+		if (i < length && text[i] == '~') {
+			if (outStep->kind == kRoxyComboRelease) {
+				return 0;
+			}
+			int holdFrames = 0;
+			for (int j = i + 1; j < length; ++j) {
+				if (!isdigit((unsigned char)text[j])) {
+					return 0;
+				}
+				holdFrames = holdFrames * 10 + (text[j] - '0');
+			}
+			outStep->kind = kRoxyComboHold;
+			outStep->holdFrames = holdFrames > 0 ? holdFrames : 1;
+			return 1;
+		}
+		start = i + 1;
+	}
+	return 1;
+}
+
+int roxy_combo_add(const char* pattern, int window) {
+	RoxyCombo* combo = NULL;
+	int id = 0;
+	for (int i = 0; i < ROXY_COMBO_MAX_COMBOS; ++i) {
+		if (!combos[i].isActive) {
+			combo = &combos[i];
+			id = i + 1;
+			break;
+		}
+	}
+	if (combo == NULL) {
+		pd->system->logToConsole("Warning: Can't add more than %d input combos.", ROXY_COMBO_MAX_COMBOS);
+		return 0;
+	}
+	
+	combo->stepCount = 0;
+	const char* text = pattern;
+	while (*text != '\0') {
+		while (*text == ' ' || *text == ',') {
+			++text;
+		}
+		int length = 0;
+		while (text[length] != '\0' && text[length] != ' ' && text[length] != ',') {
+			++length;
+		}
+		if (length == 0) {
+			break;
+		}
+		
+		if (combo->stepCount == ROXY_COMBO_MAX_STEPS || !parseStep(text, length, &combo->steps[combo->stepCount])) {
+			pd->system->logToConsole("Warning: Invalid input combo \"%s\".", pattern);
+			return 0;
+		}
+		++combo->stepCount;
+		text += length;
+	}
+	if (combo->stepCount == 0) {
+		pd->system->logToConsole("Warning: Input combo \"%s\" has no steps.", pattern);
+		return 0;
+	}
+	
+	combo->window = window > 0 ? window : ROXY_COMBO_DEFAULT_WINDOW;
+	combo->partialSteps = 0;
+	combo->isActive = 1;
+	return id;
+}
+
+void roxy_combo_remove(int id) {
+	if (id >= 1 && id <= ROXY_COMBO_MAX_COMBOS) {
+		combos[id - 1].isActive = 0;
+	}
+}
+
+void roxy_combo_clear(void) {
+	for (int i = 0; i < ROXY_COMBO_MAX_COMBOS; ++i) {
+		combos[i].isActive = 0;
+	}
+}
+
+void roxy_combo_reset(void) {
+	for (int i = 0; i < ROXY_COMBO_MAX_COMBOS; ++i) {
+		combos[i].partialSteps = 0;
+	}
+}
+
+// ! Update
+
+// Fewest frames any of the buttons has been held
+static int getHeldFrames(PDButtons buttons) {
+	int frames = -1;
+	for (int i = 0; i < (int)NUM_BUTTONS; ++i) {
+		if ((buttons & buttonNames[i].button) && (frames < 0 || heldFrames[i] < frames)) {
+			frames = heldFrames[i];
+		}
+	}
+	return frames < 0 ? 0 : frames;
+}
+
+static int matchesStep(const RoxyComboStep* step, PDButtons current, PDButtons pushed, PDButtons released) {
+	switch (step->kind) {
+		case kRoxyComboPress:
+			return (pushed & step->buttons) && (current & step->buttons) == step->buttons;
+		case kRoxyComboRelease:
+			return (released & step->buttons) != 0;
+		case kRoxyComboHold:
+			return (current & step->buttons) == step->buttons && getHeldFrames(step->buttons) == step->holdFrames;
+	}
+	return 0;
+}
+
+// Advances every partial match of a combo by one frame and returns whether one of them completed
+static int advanceCombo(RoxyCombo* combo, PDButtons current, PDButtons pushed, PDButtons released) {
+	uint32_t partialSteps = 0;
+	
+	// Later steps first, so each partial match's frame is read before an earlier one advancing into the same
+	// step replaces it. The two then continue as one, with the newer frame.
+	for (int i = combo->stepCount - 1; i >= 1; --i) {
+		if (!(combo->partialSteps & (1u << i))) {
+			continue;
+		}
+		
+		const RoxyComboStep* step = &combo->steps[i];
+		int window = combo->window + (step->kind == kRoxyComboHold ? step->holdFrames : 0);
+		
+		// Too late, or a button pressed that the next step doesn't use
+		if (frame - combo->stepFrames[i] > (uint32_t)window || (pushed & ~step->buttons)) {
+			continue;
+		}
+		
+		if (!matchesStep(step, current, pushed, released)) {
+			partialSteps |= 1u << i;
+		} else if (i + 1 == combo->stepCount) {
+			combo->partialSteps = 0;
+			return 1;
+		} else {
+			partialSteps |= 1u << (i + 1);
+			combo->stepFrames[i + 1] = frame;
+		}
+	}
+	
+	// Any frame can also start a new match
+	if (matchesStep(&combo->steps[0], current, pushed, released)) {
+		if (combo->stepCount == 1) {
+			combo->partialSteps = 0;
+			return 1;
+		}
+		partialSteps |= 1u << 1;
+		combo->stepFrames[1] = frame;
+	}
+	
+	combo->partialSteps = partialSteps;
+	return 0;
+}
+
+int roxy_combo_update(int* outMatches) {
+	PDButtons current, pushed, released;
+	roxy_input_recorder_getButtonState(&current, &pushed, &released);
+	
+	++frame;
+	for (int i = 0; i < (int)NUM_BUTTONS; ++i) {
+		heldFrames[i] = (current & buttonNames[i].button) ? heldFrames[i] + 1 : 0;
+	}
+	
+	int count = 0;
+	for (int i = 0; i < ROXY_COMBO_MAX_COMBOS; ++i) {
+		if (combos[i].isActive && advanceCombo(&combos[i], current, pushed, released)) {
+			outMatches[count++] = i + 1;
+		}
+	}
+	return count;
+}
+
+// ! Lua Bindings
+
+int roxy_combo_add_l(lua_State* L) {
+	(void)L;
+	
+	int window = pd->lua->argIsNil(2) ? 0 : pd->lua->getArgInt(2);
+	int id = roxy_combo_add(pd->lua->getArgString(1), window);
+	if (id == 0) {
+		pd->lua->pushNil();
+	} else {
+		pd->lua->pushInt(id);
+	}
+	return 1;
+}
+
+int roxy_combo_remove_l(lua_State* L) {
+	(void)L;
+	
+	roxy_combo_remove(pd->lua->getArgInt(1));
+	return 0;
+}
+
+int roxy_combo_clear_l(lua_State* L) {
+	(void)L;
+	
+	roxy_combo_clear();
+	return 0;
+}
+
+int roxy_combo_reset_l(lua_State* L) {
+	(void)L;
+	
+	roxy_combo_reset();
+	return 0;
+}
+
+// Pushes up to ROXY_COMBO_MAX_MATCHES_PER_CALL combo ids, preceded by whether more remain
+static int pushMatches(void) {
+	int remaining = matchCount - matchReadIndex;
+	int count = remaining < ROXY_COMBO_MAX_MATCHES_PER_CALL ? remaining : ROXY_COMBO_MAX_MATCHES_PER_CALL;
+	
+	pd->lua->pushBool(remaining > count);
+	for (int i = 0; i < count; ++i) {
+		pd->lua->pushInt(matches[matchReadIndex++]);
+	}
+	return 1 + count;
+}
+
+int roxy_combo_update_l(lua_State* L) {
+	(void)L;
+	
+	matchCount = roxy_combo_update(matches);
+	matchReadIndex = 0;
+	return pushMatches();
+}
+
+int roxy_combo_pop_l(lua_State* L) {
+	(void)L;
+	
+	return pushMatches();
+}
@@ -0,0 +1,53 @@
+#ifndef ROXY_COMBO_H
+#define ROXY_COMBO_H
+
+#include "pd_api.h"
+
+#define ROXY_COMBO_MAX_COMBOS 32
+#define ROXY_COMBO_MAX_STEPS 16
+#define ROXY_COMBO_DEFAULT_WINDOW 10  // Frames allowed between steps
+
+// Maximum number of combo ids returned to Lua per call, keeping the Lua stack small.
+// Remaining ids are fetched with roxy.input.popCombos.
+#define ROXY_COMBO_MAX_MATCHES_PER_CALL 8
+
+// How a step's buttons have to be used for the step to match
+typedef enum {
+	kRoxyComboPress,  // All of the step's buttons held, at least one of them pressed this frame
+	kRoxyComboRelease,  // One of the step's buttons released this frame
+	kRoxyComboHold  // All of the step's buttons held for the step's hold frames
+} RoxyComboStepKind;
+
+void roxy_combo_setPlaydateAPI(PlaydateAPI* playdate);
+
+// Compiles a pattern into a combo and returns its id, or 0 if the pattern is invalid.
+// Steps are separated by spaces or commas, and buttons within a step by '+':
+//   "down down+right right+A"  quarter circle forward, then A
+//   "A A"  double tap
+//   "A~30"  long press, A held for 30 frames
+//   "^B"  B released
+// `window` is the number of frames allowed between steps; 0 uses ROXY_COMBO_DEFAULT_WINDOW.
+int roxy_combo_add(const char* pattern, int window);
+void roxy_combo_remove(int id);
+void roxy_combo_clear(void);
+
+// Clears the progress of every combo, e.g. when the input handler changes
+void roxy_combo_reset(void);
+
+// Advances every combo with the frame's input sample (roxy_input_recorder_beginFrame).
+// Writes the ids of combos completed this frame to outMatches, which has room for ROXY_COMBO_MAX_COMBOS ids,
+// and returns how many there are.
+int roxy_combo_update(int* outMatches);
+
+// Lua bindings
+// roxy.input.addCombo(pattern, window) -> id, or nil if the pattern is invalid
+int roxy_combo_add_l(lua_State* L);
+int roxy_combo_remove_l(lua_State* L);
+int roxy_combo_clear_l(lua_State* L);
+int roxy_combo_reset_l(lua_State* L);
+// roxy.input.updateCombos() -> hasMoreMatches, id, id, ...
+int roxy_combo_update_l(lua_State* L);
+// roxy.input.popCombos() -> hasMoreMatches, id, ...; returns ids left over from updateCombos
+int roxy_combo_pop_l(lua_State* L);
+
+#endif /* ROXY_COMBO_H */
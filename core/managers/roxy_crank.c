@@ -0,0 +1,159 @@
+#include "roxy_crank.h"
+#include "roxy_input_recorder.h"
+#include <math.h>
+
+static PlaydateAPI* pd = NULL;
+
+static int hasSample = 0;  // Whether previousAngle holds a sample to measure the next change from
+static int isDocked = 1;
+static float angle = 0.0f;  // Current crank angle in degrees, 0 to 360
+static float previousAngle = 0.0f;
+static double accumulatedAngle = 0.0;  // Total signed rotation since the last reset, in degrees
+static float velocity = 0.0f;  // Filtered angular velocity, in degrees per second
+static float acceleration = 0.0f;  // Filtered angular acceleration, in degrees per second squared
+
+static int ticksPerRevolution = ROXY_CRANK_DEFAULT_TICKS_PER_REVOLUTION;
+static float smoothing = ROXY_CRANK_DEFAULT_SMOOTHING;
+static int direction = 1;
+
+void roxy_crank_setPlaydateAPI(PlaydateAPI* playdate) {
+	pd = playdate;
+}
+
+// Index of the detent that contains an accumulated angle
+static int getDetent(double accumulated) {
+	return (int)floor(accumulated * ticksPerRevolution / 360.0);
+}
+
+// ! Update
+int roxy_crank_update(float deltaTime, float* outChange) {
+	*outChange = 0.0f;
+	
+	// Read from the frame's input sample, which may be a replay
+	float sampledAngle;
+	roxy_input_recorder_getCrank(&sampledAngle, &isDocked);
+	if (isDocked) {
+		hasSample = 0;  // The crank can't turn while docked; start over from the angle when undocked
+		velocity = 0.0f;
+		acceleration = 0.0f;
+		return 0;
+	}
+	
+	// The change is measured from the angle rather than getCrankChange, which would take it from any Lua code that also reads it
+	angle = sampledAngle;
+	if (!hasSample) {
+		previousAngle = angle;
+		hasSample = 1;
+	}
+	
+	float change = angle - previousAngle;
+	if (change > 180.0f) {
+		change -= 360.0f;  // Crossed 0 going counterclockwise
+	} else if (change < -180.0f) {
+		change += 360.0f;  // Crossed 0 going clockwise
+	}
+	previousAngle = angle;
+	change *= direction;
+	
+	int ticks = 0;
+	double previousAccumulated = accumulatedAngle;
+	accumulatedAngle += change;
+	if (ticksPerRevolution > 0) {
+		ticks = getDetent(accumulatedAngle) - getDetent(previousAccumulated);
+	}
+	
+	// Low-pass filter the velocity, then the acceleration derived from it
+	if (deltaTime > 0.0f) {
+		float previousVelocity = velocity;
+		velocity = smoothing * velocity + (1.0f - smoothing) * (change / deltaTime);
+		acceleration = smoothing * acceleration + (1.0f - smoothing) * ((velocity - previousVelocity) / deltaTime);
+	}
+	
+	*outChange = change;
+	return ticks;
+}
+
+void roxy_crank_getState(float* outAngle, double* outAccumulatedAngle, float* outVelocity, float* outAcceleration, int* outIsDocked) {
+	*outAngle = angle;
+	*outAccumulatedAngle = accumulatedAngle;
+	*outVelocity = velocity;
+	*outAcceleration = acceleration;
+	*outIsDocked = isDocked;
+}
+
+// ! Settings
+void roxy_crank_setTicksPerRevolution(int newTicksPerRevolution) {
+	ticksPerRevolution = newTicksPerRevolution > 0 ? newTicksPerRevolution : 0;
+}
+
+void roxy_crank_setSmoothing(float newSmoothing) {
+	if (newSmoothing < 0.0f) {
+		newSmoothing = 0.0f;
+	} else if (newSmoothing > 0.99f) {
+		newSmoothing = 0.99f;
+	}
+	smoothing = newSmoothing;
+}
+
+void roxy_crank_setDirection(int newDirection) {
+	direction = newDirection < 0 ? -1 : 1;
+}
+
+void roxy_crank_reset(void) {
+	hasSample = 0;
+	accumulatedAngle = 0.0;
+	velocity = 0.0f;
+	acceleration = 0.0f;
+}
+
+// ! Lua Bindings
+int roxy_crank_update_l(lua_State* L) {
+	(void)L;
+	
+	float change;
+	int ticks = roxy_crank_update(pd->lua->getArgFloat(1), &change);
+	pd->lua->pushInt(ticks);
+	pd->lua->pushFloat(change);
+	pd->lua->pushFloat(velocity);
+	pd->lua->pushFloat(acceleration);
+	return 4;
+}
+
+int roxy_crank_getState_l(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushFloat(angle);
+	pd->lua->pushFloat((float)accumulatedAngle);
+	pd->lua->pushFloat(velocity);
+	pd->lua->pushFloat(acceleration);
+	pd->lua->pushBool(isDocked);
+	return 5;
+}
+
+int roxy_crank_setTicksPerRevolution_l(lua_State* L) {
+	(void)L;
+	
+	roxy_crank_setTicksPerRevolution(pd->lua->getArgInt(1));
+	return 0;
+}
+
+int roxy_crank_setSmoothing_l(lua_State* L) {
+	(void)L;
+	
+	roxy_crank_setSmoothing(pd->lua->getArgFloat(1));
+	return 0;
+}
+
+int roxy_crank_setDirection_l(lua_State* L) {
+	(void)L;
+	
+	roxy_crank_setDirection(pd->lua->getArgInt(1));
+	return 0;
+}
+
+int roxy_crank_reset_l(lua_State* L) {
+	(void)L;
+	
+	roxy_crank_reset();
+	return 0;
+}
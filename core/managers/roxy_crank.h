@@ -0,0 +1,41 @@
+#ifndef ROXY_CRANK_H
+#define ROXY_CRANK_H
+
+#include "pd_api.h"
+
+#define ROXY_CRANK_DEFAULT_TICKS_PER_REVOLUTION 6
+#define ROXY_CRANK_DEFAULT_SMOOTHING 0.5f
+
+void roxy_crank_setPlaydateAPI(PlaydateAPI* playdate);
+
+// Reads the crank from the frame's input sample (roxy_input_recorder_beginFrame) and updates the accumulated angle, velocity and acceleration.
+// Returns the number of detents crossed this frame, signed by direction, and writes the angle change in degrees.
+// Changes, ticks and velocity are multiplied by the crank direction.
+int roxy_crank_update(float deltaTime, float* outChange);
+
+// Returns the state from the last update
+void roxy_crank_getState(float* outAngle, double* outAccumulatedAngle, float* outVelocity, float* outAcceleration, int* outIsDocked);
+
+// Sets the number of detents per revolution; 0 disables ticks
+void roxy_crank_setTicksPerRevolution(int ticksPerRevolution);
+
+// Sets the weight of the previous value in the velocity and acceleration low-pass filter, from 0 (raw) up to, but not including, 1
+void roxy_crank_setSmoothing(float smoothing);
+
+// Sets the direction that counts as positive: 1 for clockwise, -1 for counterclockwise
+void roxy_crank_setDirection(int direction);
+
+// Clears the accumulated angle, velocity and acceleration, and resynchronizes with the current angle
+void roxy_crank_reset(void);
+
+// Lua bindings
+// roxy.input.updateCrank(deltaTime) -> ticks, change, velocity, acceleration
+int roxy_crank_update_l(lua_State* L);
+// roxy.input.getCrankState() -> angle, accumulatedAngle, velocity, acceleration, isDocked
+int roxy_crank_getState_l(lua_State* L);
+int roxy_crank_setTicksPerRevolution_l(lua_State* L);
+int roxy_crank_setSmoothing_l(lua_State* L);
+int roxy_crank_setDirection_l(lua_State* L);
+int roxy_crank_reset_l(lua_State* L);
+
+#endif /* ROXY_CRANK_H */
@@ -1,4 +1,5 @@
 #include "roxy_input.h"
+#include "roxy_input_recorder.h"
 #include <stdio.h>
 
 static PlaydateAPI* pd = NULL;
@@ -29,9 +30,40 @@ static int buttonHoldCounts[NUM_BUTTONS] = {0};  // Track how long each button i
 static int buttonHoldBufferAmount = 3;  // Buffer before recognizing continuous press
 static int customHoldThreshold = 20;  // Threshold for custom hold duration
 
+// Callback name suffixes, indexed by RoxyButtonEvent
+static const char* eventNames[] = {
+	"",
+	"ButtonPressed",
+	"ButtonReleased",
+	"ButtonCustomHeld",
+	"ButtonPressedContinuously"
+};
+
 // Process a button event, identified by its index in the buttons array
 static int roxy_input_processButtonEvent(lua_State* L, int buttonIndex);
 
+// Button and event constants for Lua
+static const lua_reg noFunctions[] = { { NULL, NULL } };
+static const lua_val inputConstants[] = {
+	{ "BUTTON_A", kInt, { .intval = kRoxyButtonA } },
+	{ "BUTTON_B", kInt, { .intval = kRoxyButtonB } },
+	{ "BUTTON_UP", kInt, { .intval = kRoxyButtonUp } },
+	{ "BUTTON_DOWN", kInt, { .intval = kRoxyButtonDown } },
+	{ "BUTTON_LEFT", kInt, { .intval = kRoxyButtonLeft } },
+	{ "BUTTON_RIGHT", kInt, { .intval = kRoxyButtonRight } },
+	{ "PRESSED", kInt, { .intval = kRoxyButtonPressed } },
+	{ "RELEASED", kInt, { .intval = kRoxyButtonReleased } },
+	{ "CUSTOM_HELD", kInt, { .intval = kRoxyButtonCustomHeld } },
+	{ "PRESSED_CONTINUOUSLY", kInt, { .intval = kRoxyButtonPressedContinuously } },
+	{ "BUTTON_COUNT", kInt, { .intval = ROXY_INPUT_BUTTON_COUNT } },
+	{ "EVENT_COUNT", kInt, { .intval = ROXY_INPUT_EVENT_COUNT } },
+	{ NULL, kInt, { .intval = 0 } }
+};
+
+int roxy_input_registerConstants(const char** outErr) {
+	return pd->lua->registerClass("roxy.input", noFunctions, inputConstants, 1, outErr);
+}
+
 int roxy_input_setCustomHoldThreshold_l(lua_State* L) {
 	customHoldThreshold = pd->lua->getArgInt(1);  // Set custom hold threshold from Lua
 	return 0;
@@ -72,6 +104,31 @@ int roxy_input_processButtonRight_l(lua_State* L) {
 	return roxy_input_processButtonEvent(L, 5);
 }
 
+// ! Update Button
+// Determine the event of a button from the button state, updating its hold count
+static RoxyButtonEvent updateButton(int buttonIndex, PDButtons current, PDButtons pushed, PDButtons released) {
+	PDButtons buttonState = buttons[buttonIndex].button;
+	
+	if (pushed & buttonState) {
+		buttonHoldCounts[buttonIndex] = 1;  // Start hold count on button press
+		return kRoxyButtonPressed;
+	} else if (released & buttonState) {
+		buttonHoldCounts[buttonIndex] = 0;  // Reset hold count on release
+		return kRoxyButtonReleased;
+	} else if (current & buttonState) {
+		int holdCount = ++buttonHoldCounts[buttonIndex];
+		
+		// Trigger custom hold callback if threshold is met
+		if (holdCount == customHoldThreshold) {
+			return kRoxyButtonCustomHeld;
+		} else if (holdCount >= buttonHoldBufferAmount) {
+			// Trigger continuous press callback if buffer amount is met
+			return kRoxyButtonPressedContinuously;
+		}
+	}
+	return kRoxyButtonEventNone;
+}
+
 // ! Process Button Event
 // Determine the state of the button and trigger appropriate Lua callbacks
 static int roxy_input_processButtonEvent(lua_State* L, int buttonIndex) {
@@ -80,33 +137,56 @@ static int roxy_input_processButtonEvent(lua_State* L, int buttonIndex) {
 	PDButtons current, pushed, released;
 	pd->system->getButtonState(&current, &pushed, &released);  // Get current button states
 
-	const char* button = buttons[buttonIndex].name;
-	PDButtons buttonState = buttons[buttonIndex].button;
-	int holdCount = buttonHoldCounts[buttonIndex];
-
 	static char callback[32];
 	callback[0] = '\0';
 
 	// Determine which callback to trigger based on button state
-	if (pushed & buttonState) {
-		snprintf(callback, sizeof(callback), "%sButtonPressed", button);
-		buttonHoldCounts[buttonIndex] = 1;  // Start hold count on button press
-	} else if (released & buttonState) {
-		snprintf(callback, sizeof(callback), "%sButtonReleased", button);
-		buttonHoldCounts[buttonIndex] = 0;  // Reset hold count on release
-	} else if (current & buttonState) {
-		holdCount++;
-		buttonHoldCounts[buttonIndex] = holdCount;
-
-		// Trigger custom hold callback if threshold is met
-		if (holdCount == customHoldThreshold) {
-			snprintf(callback, sizeof(callback), "%sButtonCustomHeld", button);
-		} else if (holdCount >= buttonHoldBufferAmount) {
-			// Trigger continuous press callback if buffer amount is met
-			snprintf(callback, sizeof(callback), "%sButtonPressedContinuously", button);
-		}
+	RoxyButtonEvent event = updateButton(buttonIndex, current, pushed, released);
+	if (event != kRoxyButtonEventNone) {
+		snprintf(callback, sizeof(callback), "%s%s", buttons[buttonIndex].name, eventNames[event]);
 	}
 	
 	pd->lua->pushString(callback);  // Push the callback string to Lua
 	return 1;  // Return 1 value to Lua
 }
+
+// ! Poll
+int roxy_input_poll(int* outEvents) {
+	PDButtons current, pushed, released;
+	roxy_input_recorder_getButtonState(&current, &pushed, &released);  // The frame's button state, read once for all buttons
+	
+	int count = 0;
+	for (int i = 0; i < (int)NUM_BUTTONS; ++i) {
+		RoxyButtonEvent event = updateButton(i, current, pushed, released);
+		if (event != kRoxyButtonEventNone) {
+			outEvents[count * 2] = kRoxyButtonA + i;
+			outEvents[count * 2 + 1] = event;
+			++count;
+		}
+	}
+	return count;
+}
+
+void roxy_input_reset(void) {
+	for (int i = 0; i < (int)NUM_BUTTONS; ++i) {
+		buttonHoldCounts[i] = 0;
+	}
+}
+
+int roxy_input_poll_l(lua_State* L) {
+	(void)L;
+	
+	int events[ROXY_INPUT_BUTTON_COUNT * 2];
+	int count = roxy_input_poll(events);
+	for (int i = 0; i < count * 2; ++i) {
+		pd->lua->pushInt(events[i]);
+	}
+	return count * 2;
+}
+
+int roxy_input_reset_l(lua_State* L) {
+	(void)L;
+	
+	roxy_input_reset();
+	return 0;
+}
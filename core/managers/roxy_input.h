@@ -3,8 +3,50 @@
 
 #include "pd_api.h"
 
+// Button identifiers, exposed to Lua as roxy.input.BUTTON_A, BUTTON_B, ...
+// Together with the event kinds they index the handler slots in InputManager: (button - 1) * EVENT_COUNT + event
+typedef enum {
+	kRoxyButtonA = 1,
+	kRoxyButtonB,
+	kRoxyButtonUp,
+	kRoxyButtonDown,
+	kRoxyButtonLeft,
+	kRoxyButtonRight
+} RoxyButton;
+
+#define ROXY_INPUT_BUTTON_COUNT 6
+
+// Button event kinds, exposed to Lua as roxy.input.PRESSED, RELEASED, CUSTOM_HELD and PRESSED_CONTINUOUSLY
+typedef enum {
+	kRoxyButtonEventNone,
+	kRoxyButtonPressed,
+	kRoxyButtonReleased,
+	kRoxyButtonCustomHeld,
+	kRoxyButtonPressedContinuously
+} RoxyButtonEvent;
+
+#define ROXY_INPUT_EVENT_COUNT 4
+
 void roxy_input_setPlaydateAPI(PlaydateAPI* playdate);
 
+// Registers the button and event constants in the roxy.input table. Call before adding roxy.input functions.
+int roxy_input_registerConstants(const char** outErr);
+
+// Reads the frame's button state (roxy_input_recorder_beginFrame) and updates every hold counter.
+// Writes a (button, event) pair to outEvents for each button with an event, and returns the number of pairs.
+// outEvents needs room for ROXY_INPUT_BUTTON_COUNT pairs.
+int roxy_input_poll(int* outEvents);
+
+// Resets the hold counters, e.g. when the input handler changes
+void roxy_input_reset(void);
+
+// Polls every button in one call, called from Lua.
+// roxy.input.poll() -> button, event, button, event, ...
+int roxy_input_poll_l(lua_State* L);
+
+// Resets the hold counters, called from Lua.
+int roxy_input_reset_l(lua_State* L);
+
 // Sets the buffer amount for detecting a continuous button hold, called from Lua.
 int roxy_input_setButtonHoldBufferAmount_l(lua_State* L);
 
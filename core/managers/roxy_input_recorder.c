@@ -0,0 +1,354 @@
+#include "roxy_input_recorder.h"
+#include "../../utilities/roxy_time.h"
+
+static PlaydateAPI* pd = NULL;
+
+// Input sampled for the current frame
+static PDButtons current = 0;
+static PDButtons pushed = 0;
+static PDButtons released = 0;
+static float crankAngle = 0.0f;
+static int isCrankDocked = 1;
+
+// Ring buffer of records, oldest at `start`
+static RoxyInputRecord* records = NULL;
+static int recordCapacity = 0;
+static int recordCount = 0;
+static int recordStart = 0;
+static uint32_t frameCount = 0;  // Frames covered by the recording, including unchanged ones
+
+static int isRecording = 0;
+static uint32_t recordingFrame = 0;
+static double recordingTime = 0.0;
+
+static int isReplaying = 0;
+static uint32_t replayFrame = 0;
+static int replayIndex = 0;  // Next record to apply, counted from the oldest
+
+// Recording file header, followed by recordCount records
+typedef struct {
+	char magic[4];
+	int32_t version;
+	int32_t recordCount;
+	uint32_t frameCount;
+} RoxyInputRecordingHeader;
+
+void roxy_input_recorder_setPlaydateAPI(PlaydateAPI* playdate) {
+	pd = playdate;
+}
+
+static RoxyInputRecord* getRecord(int index) {
+	return &records[(recordStart + index) % recordCapacity];
+}
+
+// ! Begin Frame
+
+static void replayFrameInput(void) {
+	// Between records, buttons stay held and the crank stays where it was
+	pushed = 0;
+	released = 0;
+	
+	if (replayIndex < recordCount) {
+		RoxyInputRecord* record = getRecord(replayIndex);
+		if (record->frame - getRecord(0)->frame == replayFrame) {
+			current = record->current;
+			pushed = record->pushed;
+			released = record->released;
+			crankAngle = record->crankAngle;
+			isCrankDocked = record->isCrankDocked;
+			++replayIndex;
+		}
+	}
+	
+	if (++replayFrame >= frameCount) {
+		isReplaying = 0;  // Back to live input from the next frame
+	}
+}
+
+static void recordFrameInput(PDButtons previousCurrent, float previousAngle, int previousDocked) {
+	float rawDeltaTime, smoothedDeltaTime, deltaTime;
+	roxy_time_getFrameStats(&rawDeltaTime, &smoothedDeltaTime, &deltaTime);
+	if (recordingFrame > 0) {
+		recordingTime += rawDeltaTime;
+	}
+	
+	int changed = recordingFrame == 0 || pushed || released || current != previousCurrent
+		|| crankAngle != previousAngle || isCrankDocked != previousDocked;
+	if (changed) {
+		RoxyInputRecord* record;
+		if (recordCount < recordCapacity) {
+			record = getRecord(recordCount++);
+		} else {
+			record = getRecord(0);  // Overwrite the oldest record
+			recordStart = (recordStart + 1) % recordCapacity;
+		}
+		record->frame = recordingFrame;
+		record->time = (float)recordingTime;
+		record->current = (uint8_t)current;
+		record->pushed = (uint8_t)pushed;
+		record->released = (uint8_t)released;
+		record->isCrankDocked = (uint8_t)isCrankDocked;
+		record->crankAngle = crankAngle;
+	}
+	
+	++recordingFrame;
+	frameCount = recordingFrame - getRecord(0)->frame;
+}
+
+void roxy_input_recorder_beginFrame(void) {
+	if (isReplaying) {
+		replayFrameInput();
+		return;
+	}
+	
+	PDButtons previousCurrent = current;
+	float previousAngle = crankAngle;
+	int previousDocked = isCrankDocked;
+	
+	pd->system->getButtonState(&current, &pushed, &released);
+	isCrankDocked = pd->system->isCrankDocked();
+	crankAngle = isCrankDocked ? crankAngle : pd->system->getCrankAngle();
+	
+	if (isRecording) {
+		recordFrameInput(previousCurrent, previousAngle, previousDocked);
+	}
+}
+
+void roxy_input_recorder_getButtonState(PDButtons* outCurrent, PDButtons* outPushed, PDButtons* outReleased) {
+	*outCurrent = current;
+	*outPushed = pushed;
+	*outReleased = released;
+}
+
+void roxy_input_recorder_getCrank(float* outAngle, int* outIsDocked) {
+	*outAngle = crankAngle;
+	*outIsDocked = isCrankDocked;
+}
+
+// ! Recording
+
+static int reserveRecords(int capacity) {
+	if (capacity <= recordCapacity) {
+		return 1;
+	}
+	RoxyInputRecord* newRecords = pd->system->realloc(records, sizeof(RoxyInputRecord) * capacity);
+	if (newRecords == NULL) {
+		pd->system->logToConsole("Warning: Failed to allocate %d input records.", capacity);
+		return 0;
+	}
+	records = newRecords;
+	recordCapacity = capacity;
+	return 1;
+}
+
+int roxy_input_recorder_startRecording(int capacity) {
+	if (capacity <= 0) {
+		capacity = ROXY_INPUT_RECORDER_DEFAULT_CAPACITY;
+	} else if (capacity > ROXY_INPUT_RECORDER_MAX_CAPACITY) {
+		pd->system->logToConsole("Warning: Input recordings hold at most %d records, got %d.", ROXY_INPUT_RECORDER_MAX_CAPACITY, capacity);
+		capacity = ROXY_INPUT_RECORDER_MAX_CAPACITY;
+	}
+	isReplaying = 0;
+	if (!reserveRecords(capacity)) {
+		return 0;
+	}
+	
+	recordCount = 0;
+	recordStart = 0;
+	frameCount = 0;
+	recordingFrame = 0;
+	recordingTime = 0.0;
+	isRecording = 1;
+	return 1;
+}
+
+void roxy_input_recorder_stopRecording(void) {
+	isRecording = 0;
+}
+
+int roxy_input_recorder_isRecording(void) {
+	return isRecording;
+}
+
+int roxy_input_recorder_save(const char* path) {
+	if (recordCount == 0) {
+		pd->system->logToConsole("Warning: No input recorded to save to %s.", path);
+		return 0;
+	}
+	
+	SDFile* file = pd->file->open(path, kFileWrite);
+	if (file == NULL) {
+		pd->system->logToConsole("Warning: Failed to open %s for writing, %s", path, pd->file->geterr());
+		return 0;
+	}
+	
+	RoxyInputRecordingHeader header;
+	memcpy(header.magic, ROXY_INPUT_RECORDER_MAGIC, sizeof(header.magic));
+	header.version = ROXY_INPUT_RECORDER_VERSION;
+	header.recordCount = recordCount;
+	header.frameCount = frameCount;
+	
+	int success = pd->file->write(file, &header, sizeof(header)) == (int)sizeof(header);
+	
+	// Written oldest first, in up to two runs around the end of the ring buffer
+	int firstRun = recordCapacity - recordStart < recordCount ? recordCapacity - recordStart : recordCount;
+	unsigned int firstSize = sizeof(RoxyInputRecord) * firstRun;
+	unsigned int secondSize = sizeof(RoxyInputRecord) * (recordCount - firstRun);
+	success = success && pd->file->write(file, records + recordStart, firstSize) == (int)firstSize;
+	if (secondSize > 0) {
+		success = success && pd->file->write(file, records, secondSize) == (int)secondSize;
+	}
+	pd->file->close(file);
+	
+	if (!success) {
+		pd->system->logToConsole("Warning: Failed to write input recording to %s.", path);
+	}
+	return success;
+}
+
+int roxy_input_recorder_load(const char* path) {
+	SDFile* file = pd->file->open(path, kFileReadData | kFileRead);
+	if (file == NULL) {
+		pd->system->logToConsole("Warning: Failed to open %s, %s", path, pd->file->geterr());
+		return 0;
+	}
+	
+	RoxyInputRecordingHeader header;
+	if (pd->file->read(file, &header, sizeof(header)) != (int)sizeof(header)
+		|| memcmp(header.magic, ROXY_INPUT_RECORDER_MAGIC, sizeof(header.magic)) != 0
+		|| header.version != ROXY_INPUT_RECORDER_VERSION
+		|| header.recordCount < 1
+		|| header.recordCount > ROXY_INPUT_RECORDER_MAX_CAPACITY) {
+		pd->system->logToConsole("Warning: %s is not an input recording.", path);
+		pd->file->close(file);
+		return 0;
+	}
+	
+	isRecording = 0;
+	isReplaying = 0;
+	int success = reserveRecords(header.recordCount);
+	unsigned int dataSize = sizeof(RoxyInputRecord) * header.recordCount;
+	if (success && pd->file->read(file, records, dataSize) != (int)dataSize) {
+		pd->system->logToConsole("Warning: %s is shorter than its header says.", path);
+		success = 0;
+	}
+	pd->file->close(file);
+	
+	// Replay steps through the records in frame order, until the last covered frame
+	if (success) {
+		for (int i = 1; i < header.recordCount; ++i) {
+			if (records[i].frame <= records[i - 1].frame) {
+				success = 0;
+				break;
+			}
+		}
+		if (success && header.frameCount <= records[header.recordCount - 1].frame - records[0].frame) {
+			success = 0;
+		}
+		if (!success) {
+			pd->system->logToConsole("Warning: %s has records out of order or past its frame count.", path);
+		}
+	}
+	
+	recordStart = 0;
+	recordCount = success ? header.recordCount : 0;
+	frameCount = success ? header.frameCount : 0;
+	return success;
+}
+
+// ! Replay
+
+int roxy_input_recorder_startReplay(void) {
+	if (recordCount == 0) {
+		pd->system->logToConsole("Warning: No input recorded to replay.");
+		return 0;
+	}
+	isRecording = 0;
+	isReplaying = 1;
+	replayFrame = 0;
+	replayIndex = 0;
+	return 1;
+}
+
+void roxy_input_recorder_stopReplay(void) {
+	isReplaying = 0;
+}
+
+int roxy_input_recorder_isReplaying(void) {
+	return isReplaying;
+}
+
+// ! Lua Bindings
+
+int roxy_input_recorder_beginFrame_l(lua_State* L) {
+	(void)L;
+	
+	roxy_input_recorder_beginFrame();
+	return 0;
+}
+
+int roxy_input_recorder_startRecording_l(lua_State* L) {
+	(void)L;
+	
+	int capacity = pd->lua->argIsNil(1) ? 0 : pd->lua->getArgInt(1);
+	pd->lua->pushBool(roxy_input_recorder_startRecording(capacity));
+	return 1;
+}
+
+int roxy_input_recorder_stopRecording_l(lua_State* L) {
+	(void)L;
+	
+	roxy_input_recorder_stopRecording();
+	return 0;
+}
+
+int roxy_input_recorder_isRecording_l(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushBool(isRecording);
+	return 1;
+}
+
+int roxy_input_recorder_save_l(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushBool(roxy_input_recorder_save(pd->lua->getArgString(1)));
+	return 1;
+}
+
+int roxy_input_recorder_load_l(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushBool(roxy_input_recorder_load(pd->lua->getArgString(1)));
+	return 1;
+}
+
+int roxy_input_recorder_startReplay_l(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushBool(roxy_input_recorder_startReplay());
+	return 1;
+}
+
+int roxy_input_recorder_stopReplay_l(lua_State* L) {
+	(void)L;
+	
+	roxy_input_recorder_stopReplay();
+	return 0;
+}
+
+int roxy_input_recorder_isReplaying_l(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushBool(isReplaying);
+	return 1;
+}
+
+int roxy_input_recorder_getInfo_l(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushInt(recordCount);
+	pd->lua->pushInt((int)frameCount);
+	pd->lua->pushFloat(recordCount > 0 ? getRecord(recordCount - 1)->time - getRecord(0)->time : 0.0f);
+	return 3;
+}
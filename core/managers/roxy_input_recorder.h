@@ -0,0 +1,65 @@
+#ifndef ROXY_INPUT_RECORDER_H
+#define ROXY_INPUT_RECORDER_H
+
+#include "pd_api.h"
+
+#define ROXY_INPUT_RECORDER_DEFAULT_CAPACITY 4096
+#define ROXY_INPUT_RECORDER_MAX_CAPACITY 65536  // 1 MB of records; also bounds the count read from a file
+#define ROXY_INPUT_RECORDER_MAGIC "RXIN"
+#define ROXY_INPUT_RECORDER_VERSION 1
+
+// Raw input for one frame. A record is only kept for frames where something changed,
+// so frames between records repeat the held buttons and crank angle of the previous one.
+typedef struct {
+	uint32_t frame;  // Frame index since recording started
+	float time;  // Seconds since recording started, summed from the high-resolution delta time
+	uint8_t current;  // PDButtons held, pushed and released this frame
+	uint8_t pushed;
+	uint8_t released;
+	uint8_t isCrankDocked;
+	float crankAngle;
+} RoxyInputRecord;
+
+void roxy_input_recorder_setPlaydateAPI(PlaydateAPI* playdate);
+
+// Samples the frame's input once, from the device or from a replay, and records it when recording.
+// Call once per frame before roxy_input_poll and roxy_crank_update, which read the sampled input.
+void roxy_input_recorder_beginFrame(void);
+
+// Input sampled by the last beginFrame
+void roxy_input_recorder_getButtonState(PDButtons* outCurrent, PDButtons* outPushed, PDButtons* outReleased);
+void roxy_input_recorder_getCrank(float* outAngle, int* outIsDocked);
+
+// ! Recording
+// Records into a ring buffer of `capacity` records; once full, the oldest records are overwritten.
+int roxy_input_recorder_startRecording(int capacity);
+void roxy_input_recorder_stopRecording(void);
+int roxy_input_recorder_isRecording(void);
+
+// Writes the recorded records to a file in the game's Data folder
+int roxy_input_recorder_save(const char* path);
+
+// Replaces the recorded records with a file written by roxy_input_recorder_save,
+// checking the Data folder before the game bundle
+int roxy_input_recorder_load(const char* path);
+
+// ! Replay
+// Replays the recorded input in place of the device's, frame by frame, then returns to live input
+int roxy_input_recorder_startReplay(void);
+void roxy_input_recorder_stopReplay(void);
+int roxy_input_recorder_isReplaying(void);
+
+// Lua bindings
+int roxy_input_recorder_beginFrame_l(lua_State* L);
+int roxy_input_recorder_startRecording_l(lua_State* L);
+int roxy_input_recorder_stopRecording_l(lua_State* L);
+int roxy_input_recorder_isRecording_l(lua_State* L);
+int roxy_input_recorder_save_l(lua_State* L);
+int roxy_input_recorder_load_l(lua_State* L);
+int roxy_input_recorder_startReplay_l(lua_State* L);
+int roxy_input_recorder_stopReplay_l(lua_State* L);
+int roxy_input_recorder_isReplaying_l(lua_State* L);
+// roxy.input.getRecordingInfo() -> recordCount, frameCount, duration
+int roxy_input_recorder_getInfo_l(lua_State* L);
+
+#endif /* ROXY_INPUT_RECORDER_H */
@@ -102,6 +102,11 @@ function RoxyScene:cleanup()
 	end
 	self:removeAllSprites()  -- Remove all sprites from the scene
 	self:removeAllSequence()  -- Remove all the sequences from the scene
+	sequenceManager:releaseAll(self)  -- Return the scene's pooled sequences
+	if self.assetLoader then
+		self.assetLoader:release()  -- Release the assets loaded from the scene's manifest
+		self.assetLoader = nil
+	end
 	self:clearScreen()  -- Clear the screen
 	self:resetDrawOffset()  -- Reset the drawing offset
 end
@@ -153,6 +158,12 @@ function RoxyScene:removeAllSprites()
 	end
 end
 
+-- ! Acquire Sequence
+-- Returns a pooled sequence owned by the scene; it is returned to the pool when the scene is cleaned up
+function RoxyScene:acquireSequence()
+	return sequenceManager:acquire(self)
+end
+
 -- ! Add and Remove Sequences
 function RoxyScene:addSequence(sequence)
 	if sequence and not table.indexOfElement(self.sequences, sequence) then
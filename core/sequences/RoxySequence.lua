@@ -9,44 +9,68 @@ local pd <const> = playdate
 local Object <const> = pd.object
 local Ease <const> = roxy.easingFunctions
 local Sequence <const> = roxy.sequence
+local Time <const> = roxy.time
+
+-- Loop modes, exported from `RoxySequenceLoopType` in roxy_sequence.h
+local LOOP <const> = Sequence.LOOP
+local PING_PONG <const> = Sequence.PINGPONG
+
+-- Easing identifier for segments eased by a Lua function, matching `ROXY_SEQUENCE_EASE_LUA`
+local EASE_LUA <const> = -1
+
+-- Samples a baked track can hold, matching `ROXY_SEQUENCE_MAX_BAKED_SAMPLES`
+local MAX_BAKED_SAMPLES <const> = 65536
+
+-- Returns the value passed to the native sequence for an easing: a built-in identifier,
+-- a `roxy.curve`, or `EASE_LUA` for custom Lua functions evaluated by `getValue`.
+local function resolveEase(easeFunction)
+	local easeId = Ease.getId(easeFunction)
+	if easeId then
+		return easeId
+	elseif type(easeFunction) == "userdata" then
+		return easeFunction  -- Native custom curve (roxy.easingFunctions.cubicBezier/piecewise)
+	end
+	return EASE_LUA
+end
+
+-- Stores values into a table starting at index, without creating a table for them
+local function fillTable(out, index, value, ...)
+	if value == nil then return end
+	out[index] = value
+	return fillTable(out, index + 1, ...)
+end
 
 class("RoxySequence").extends()
 
+RoxySequence.EASE_LUA = EASE_LUA
+RoxySequence.resolveEase = resolveEase
+
+-- The easings, time, pacing and callback timing live in a native sequence object (roxy_sequence.c),
+-- and running sequences are advanced by the native sequence pool.
+-- This class keeps the chainable Lua API, callback functions, and sequence manager registration.
 function RoxySequence:init()
 	RoxySequence.super.init(self)
 	
-	-- Initialize runtime values
-	self.time = 0				-- The current time in the sequence's progression
-	self.cachedResultTimestamp = nil  -- Cached timestamp to optimize repeated calculations
-	self.cachedResult = 0		-- Cached result of the sequence value
-	self.previousUpdateEasingIndex = nil  -- Index of the last easing updated to avoid redundant searches
-	self.isRunning = false		-- Indicates whether the sequence is currently running
-	self.previousUpdateTime = nil  -- Previous time used to calculate deltaTime
+	self.native = Sequence.new()	-- Native sequence holding the easings and current time
+	self.id = self.native:getId()	-- Identifies the sequence in native pool events
 
 	-- Initialize sequence configuration
-	self.duration = 0			-- Total duration of the sequence
 	self.pacing = 1				-- Pacing multiplier to speed up or slow down the sequence
-	self.loopType = false		-- Type of looping behavior (e.g., loop, ping-pong)
-	self.easings = {}			-- List of easing functions applied in the sequence
 	self.easingCount = 0		-- Number of easings in the sequence
+	self.luaEasings = {}		-- Custom Lua easing functions, keyed by easing index
 	self.callbacks = {}			-- List of callback functions to be triggered at specific times
 end
 
 -- ! Clear
 function RoxySequence:clear(clearEasings)
 	self:stop()  -- Stop the sequence
-	self.time = 0
-	self.cachedResultTimestamp = nil
-	self.cachedResult = 0
-	self.previousUpdateEasingIndex = nil
-	self.previousUpdateTime = nil
-	self.duration = 0
-	self.loopType = false
+	self.native:clear()  -- Clears easings, callbacks and time; the native storage is kept for reuse
 	self.easingCount = 0
 	self.callbacks = {}
 
-	if clearEasings then
-		self.easings = {}  -- Clear all easings if specified
+	-- `clearEasings` is kept for compatibility; native easing storage is always reused
+	if next(self.luaEasings) then
+		self.luaEasings = {}
 	end
 end
 
@@ -55,12 +79,10 @@ function RoxySequence:add()
 	if self.easingCount == 0 then return end
 	
 	sequenceManager:add(self)  -- Add the sequence to the manager to start updating it
-	self.isRunning = true
 end
 
 function RoxySequence:remove()
 	sequenceManager:remove(self)  -- Remove the sequence from the manager to stop updating it
-	self.isRunning = false
 end
 
 -- ! Get and Set Pacing 
@@ -71,37 +93,25 @@ end
 function RoxySequence:setPacing(pacing)
 	pacing = pacing or 1
 	self.pacing = pacing  -- Set the pacing multiplier
+	self.native:setPacing(pacing)
 	return self
 end
 
 -- ! Loop and Ping-Pong
 function RoxySequence:loop()
-	self.loopType = "loop"  -- Set sequence to loop continuously
+	self.native:setLoopType(LOOP)  -- Set sequence to loop continuously
 	return self
 end
 
 function RoxySequence:pingPong()
-	self.loopType = "ping-pong"  -- Set sequence to alternate direction after each completion
+	self.native:setLoopType(PING_PONG)  -- Set sequence to alternate direction after each completion
 	return self
 end
 
 -- ! Set Previous Update Time
 function RoxySequence:setPreviousUpdateTime(currentTime)
 	currentTime = currentTime or pd.getCurrentTimeMilliseconds()
-	self.previousUpdateTime = currentTime  -- Store the time for calculating deltaTime
-end
-
--- ! Add Easing
-function RoxySequence:addEasing(timestamp, from, to, duration, easeFunction)
-	self.easingCount += 1
-	local easing = {
-		timestamp = timestamp,	-- Timestamp: The starting time of the easing
-		from = from,			-- From: The initial value of the easing
-		to = to,				-- To: The final value of the easing
-		duration = duration,	-- Duration: The duration of the easing
-		easeFunction = easeFunction  -- Easing function: The easing function to use
-	}
-	self.easings[self.easingCount] = easing  -- Store the easing in the sequence
+	self.native:setPreviousUpdateTime(currentTime)  -- Store the time for calculating deltaTime
 end
 
 --! From
@@ -109,13 +119,7 @@ function RoxySequence:from(from)
 	from = from or 0
 
 	self:clear()  -- Clear previous easings and configurations
-	self:addEasing(
-		0,						-- Timestamp
-		from,					-- From
-		from,					-- To
-		0,						-- Duration
-		Ease.flat				-- Easing function
-	)
+	self.easingCount = self.native:from(from)
 
 	return self
 end
@@ -128,34 +132,20 @@ function RoxySequence:to(to, duration, easeFunction)
 	duration = duration or 0.3
 	easeFunction = easeFunction or Ease.inOutQuad
 
-	local lastEasing = self.easings[self.easingCount]
-	self:addEasing(
-		lastEasing.timestamp + lastEasing.duration,  -- Timestamp
-		lastEasing.to,			-- From
-		to,						-- To
-		duration,				-- Duration
-		easeFunction			-- Easing function
-	)
-
-	self.duration += duration  -- Update total sequence duration
+	local ease = resolveEase(easeFunction)
+	self.easingCount = self.native:to(to, duration, ease)
+	if ease == EASE_LUA then
+		self.luaEasings[self.easingCount] = easeFunction
+	end
 	
 	return self
 end
 
 -- ! Set
 function RoxySequence:set(value)
-	print(value)
-	
 	if self.easingCount == 0 then return self end
 	
-	local lastEasing = self.easings[self.easingCount]
-	self:addEasing(
-		lastEasing.timestamp + lastEasing.duration,  -- Timestamp
-		value,					-- From
-		value,					-- To
-		0,						-- Duration
-		Ease.flat				-- Easing function
-	)
+	self.easingCount = self.native:set(value)
 	
 	return self
 end
@@ -165,22 +155,15 @@ function RoxySequence:again(repeatCount, pingPong)
 	if self.easingCount == 0 then return self end
 	
 	repeatCount = repeatCount or 1
-	local previousEasing = self.easings[self.easingCount]
-
-	for i = 1, repeatCount do
-		local from, to = previousEasing.from, previousEasing.to
-		if pingPong then
-			from, to = to, from  -- Swap the values for ping-pong behavior
+	local previousCount = self.easingCount
+	self.easingCount = self.native:again(repeatCount, pingPong == true)
+	
+	-- Repeated Lua-eased segments keep using the same Lua function
+	local luaEasing = self.luaEasings[previousCount]
+	if luaEasing then
+		for i = previousCount + 1, self.easingCount do
+			self.luaEasings[i] = luaEasing
 		end
-		local newEasing = self:addEasing(
-			previousEasing.timestamp + previousEasing.duration,  -- Timestamp
-			from,               -- From
-			to,                 -- To
-			previousEasing.duration,  -- Duration
-			previousEasing.easeFunction  -- Easing function
-		)
-		self.duration += previousEasing.duration  -- Update total sequence duration
-		previousEasing = newEasing
 	end
 
 	return self
@@ -191,17 +174,7 @@ function RoxySequence:sleep(duration)
 	if self.easingCount == 0 or duration == 0 then return self end
 	
 	duration = duration or 0.5
-
-	local lastEasing = self.easings[self.easingCount]
-	self:addEasing(
-		lastEasing.timestamp + lastEasing.duration,  -- Timestamp
-		lastEasing.to,			-- From
-		lastEasing.to,			-- To
-		duration,				-- Duration
-		Ease.flat				-- Easing function
-	)
-	
-	self.duration += duration  -- Update total sequence duration
+	self.easingCount = self.native:sleep(duration)
 	
 	return self
 end
@@ -212,12 +185,12 @@ function RoxySequence:callback(callbackFunction, timeOffset)
 	
 	timeOffset = timeOffset or 0
 
-	local lastEasing = self.easings[self.easingCount]
 	local callbackObject = {
 		callbackFunction = callbackFunction,
-		timestamp = lastEasing.timestamp + lastEasing.duration + timeOffset
+		timestamp = self.native:getDuration() + timeOffset  -- The end of the last easing
 	}
 	table.insert(self.callbacks, callbackObject)  -- Register the callback
+	self.native:addCallback(callbackObject.timestamp)  -- Timing is checked in C, in the same order
 
 	return self
 end
@@ -226,24 +199,18 @@ end
 function RoxySequence:reverse()
 	if self.easingCount == 0 then return self end
 	
-	local reversedEasings = {}
-	local duration = self.duration
-
-	for i = #self.easings, 1, -1 do
-		local easing = self.easings[i]
-		table.insert(reversedEasings, {
-			timestamp = duration - (easing.timestamp + easing.duration),
-			from = easing.to,
-			to = easing.from,
-			duration = easing.duration,
-			easeFunction = easing.easeFunction,
-			params = easing.params
-		})
+	self.native:reverse()
+	
+	-- Keep Lua easing functions attached to their reversed segments
+	if next(self.luaEasings) then
+		local reversedLuaEasings = {}
+		local easingCount = self.easingCount
+		for index, easeFunction in pairs(self.luaEasings) do
+			reversedLuaEasings[easingCount + 1 - index] = easeFunction
+		end
+		self.luaEasings = reversedLuaEasings
 	end
 
-	self.easings = reversedEasings  -- Replace with reversed easings
-	self.previousUpdateEasingIndex = nil  -- Reset index for next update
-
 	return self
 end
 
@@ -251,7 +218,7 @@ end
 function RoxySequence:start()
 	if self.easingCount == 0 then return self end
 	
-	if not self.isRunning then
+	if not self.native:isRunning() then
 		self:add()  -- Add to the sequence manager if not already running
 	end
 	
@@ -261,9 +228,7 @@ end
 -- ! Stop
 function RoxySequence:stop()
 	self:remove()  -- Stop and remove from the sequence manager
-	self.time = 0
-	self.cachedResultTimestamp = nil
-	self.previousUpdateEasingIndex = nil
+	self.native:setTime(0)
 	return self
 end
 
@@ -277,9 +242,7 @@ end
 function RoxySequence:restart()
 	if self.easingCount == 0 then return self end
 	
-	self.time = 0  -- Reset sequence time
-	self.cachedResultTimestamp = nil
-	self.previousUpdateEasingIndex = nil
+	self.native:setTime(0)  -- Reset sequence time
 	self:start()
 	
 	return self
@@ -287,145 +250,147 @@ end
 
 -- ! Is Done
 function RoxySequence:isDone()
-	return self.time >= self.duration and not self.loopType  -- Check if sequence has completed
+	return self.native:isDone()  -- Check if sequence has completed
 end
 
--- ! Get Easing by Time
-function RoxySequence:getEasingByTime(clampedTime)
-	if self.easingCount == 0 then
-		warn("Warning: Empty sequence animation.")
-		return nil
-	end
+-- ! Get Time and Duration
+function RoxySequence:getTime()
+	return self.native:getTime()
+end
 
-	local startIndex = self.previousUpdateEasingIndex or 1
-	local endIndex = self.easingCount
+function RoxySequence:getDuration()
+	return self.native:getDuration()
+end
 
-	while startIndex <= endIndex do
-		local middleIndex = math.floor((startIndex + endIndex) / 2)
-		local easing = self.easings[middleIndex]
+-- ! Get Clamped Time
+function RoxySequence:getClampedTime(time)
+	return self.native:getClampedTime(time)  -- Runs in C (roxy_sequence.c) for optimized performance
+end
 
-		if clampedTime < easing.timestamp then
-			endIndex = middleIndex - 1
-		elseif clampedTime > (easing.timestamp + easing.duration) then
-			startIndex = middleIndex + 1
-		else
-			self.previousUpdateEasingIndex = middleIndex
-			return easing
-		end
+-- ! Invoke Callback
+function RoxySequence:invokeCallback(index)
+	local callbackObject = self.callbacks[index]
+	if callbackObject and type(callbackObject.callbackFunction) == "function" then
+		callbackObject.callbackFunction()  -- Execute the callback
 	end
+end
 
-	warn("Warning: Sequence part not found: 'clampedTime' is likely out of bounds.", clampedTime, self.duration)
-	return self.easings[1]  -- Default to the first easing if not found
+local function invokeCallbacks(sequence, index, ...)
+	if not index then return end
+	sequence:invokeCallback(index)
+	return invokeCallbacks(sequence, ...)
 end
 
--- ! Get Clamped Time
-function RoxySequence:getClampedTime(time)
-	time = time or self.time
-	return Sequence.getClampedTime(time, self.duration, self.loopType)  -- Runs in C (roxy_sequence.c) for optimized performance
+-- ! Update Loop
+-- Running sequences are updated by the sequence manager's native pool; this updates a single
+-- sequence directly, e.g. one that is driven manually instead of being started.
+function RoxySequence:update(deltaTime)
+	-- Pacing, real-time delta and callback timing are handled in C (roxy_sequence.c)
+	local hasMoreEvents = self:dispatchEvents(self.native:update(deltaTime))
+	while hasMoreEvents do
+		hasMoreEvents = self:dispatchEvents(self.native:popEvents())
+	end
+end
 
+function RoxySequence:dispatchEvents(hasMoreEvents, ...)
+	invokeCallbacks(self, ...)
+	return hasMoreEvents
 end
 
--- ! Update Callbacks
-function RoxySequence:updateCallbacks(deltaTime)
-	if self.easingCount == 0 then return end
+-- ! Get Value (Value Calculation/Progress)
+function RoxySequence:getValue(defaultValue, time)
+	-- Built-in and curve easings are evaluated entirely in C (roxy_sequence.c)
+	local result, index, t, b, c, d = self.native:getValue(defaultValue, time)
+	if result ~= nil then
+		return result
+	end
 	
-	local duration = self.duration
-	local loopType = self.loopType
-	local clampedTime, isForward = Sequence.getClampedTime(self.time, duration, loopType)  -- Runs in C (roxy_sequence.c) for optimized performance
-
-	local endTime = isForward and clampedTime + deltaTime or clampedTime - deltaTime
-	local clampedEndTime, _ = Sequence.getClampedTime(endTime, duration, loopType)  -- Runs in C (roxy_sequence.c) for optimized performance
-
-		
-	-- Call the callbacks within a specified time range
-	local function invokeCallbacksInRange(clampedStart, clampedEnd)
-		if clampedStart > clampedEnd then
-			clampedStart, clampedEnd = clampedEnd, clampedStart
-		end
-		
-		for i = 1, #self.callbacks do
-			local callbackObject = self.callbacks[i]
-			if callbackObject.timestamp >= clampedStart and callbackObject.timestamp <= clampedEnd then
-				if type(callbackObject.callbackFunction) == "function" then
-					callbackObject.callbackFunction()  -- Execute the callback
-				end
-			end
-		end
+	-- Segments eased by custom Lua functions come back with their easing arguments
+	result = self.luaEasings[index](t, b, c, d)
+	
+	-- Check for NaN on result
+	if result ~= result then
+		result = defaultValue or 0  -- Fallback to default if result is NaN
+	end
+
+	return result
+end
+
+-- ! Get Interpolated Value
+-- With a fixed timestep, returns the value between the last two steps at the render alpha
+-- (roxy.time.getAlpha), so motion stays smooth when steps and frames don't line up.
+function RoxySequence:getInterpolatedValue(defaultValue)
+	local fixedStep = Time.getFixedStep()
+	if fixedStep == 0 or not self.native:isRunning() then
+		return self:getValue(defaultValue)
 	end
 	
-	-- Handle no loop scenario
-	if not loopType then
-		invokeCallbacksInRange(clampedTime, clampedTime + deltaTime)
-		return
+	local time = self.native:getTime() - (1 - Time.getAlpha()) * fixedStep * self.pacing
+	return self:getValue(defaultValue, math.max(time, 0))
+end
+
+-- ! Bake
+-- Pre-samples the sequence into a native track, read back with a lerp by `getValue`.
+-- Any later change to the easings drops the track.
+function RoxySequence:bake(sampleRate)
+	if self.easingCount == 0 then return self end
+	
+	sampleRate = sampleRate or pd.display.getRefreshRate()
+	if self.native:bake(sampleRate) then
+		return self  -- Built-in and curve easings are sampled entirely in C
 	end
 	
-	-- Handle loop scenarios
-	if deltaTime > duration then
-		invokeCallbacksInRange(0, duration)
+	-- Lua-eased segments are sampled here, then copied into the native track
+	local duration = self.native:getDuration()
+	local channelCount = self.native:getChannelCount()
+	local sampleCount = math.max(math.ceil(duration * sampleRate) + 1, 2)
+	if sampleCount > MAX_BAKED_SAMPLES then
+		warn("Warning: Baked tracks hold at most " .. MAX_BAKED_SAMPLES .. " samples, got " .. sampleCount .. ".")
+		return self
 	end
 	
-	if endTime < 0 then
-		invokeCallbacksInRange(0, math.max(clampedTime, clampedEndTime))
-	elseif endTime > duration then
-		if loopType == "loop" then
-			invokeCallbacksInRange(clampedTime, duration)
-			invokeCallbacksInRange(0, clampedEndTime)
-		else
-			invokeCallbacksInRange(math.min(clampedTime, clampedEndTime), duration)
-		end
-	else
-		invokeCallbacksInRange(clampedTime, endTime)
+	self.native:clearBake()  -- Sample the easings, not a previously baked track
+	local samples = {}
+	for i = 0, sampleCount - 1 do
+		fillTable(samples, i * channelCount + 1, self:getBakeValues(duration * i / (sampleCount - 1)))
 	end
-end
-
--- ! Update Loop
-function RoxySequence:update(deltaTime)
-	local pacing = self.pacing
-	deltaTime = deltaTime * pacing
 	
-	-- Adjust deltaTime based on the previous update time, if set
-	if self.previousUpdateTime then
-		local currentTime = playdate.getCurrentTimeMilliseconds()
-		deltaTime = (currentTime - self.previousUpdateTime) / 1000 * pacing
-		self.previousUpdateTime = currentTime
+	if self.native:beginBake(sampleCount) then
+		for i = 1, sampleCount do
+			local first = (i - 1) * channelCount + 1
+			self.native:setBakedSample(i, table.unpack(samples, first, first + channelCount - 1))
+		end
 	end
 	
-	self:updateCallbacks(deltaTime)
-	self.time += deltaTime  -- Increment the sequence time
-	self.cachedResultTimestamp = nil  -- Invalidate cached result to ensure recalculation
+	return self
 end
 
--- ! Get Value (Value Calculation/Progress)
-function RoxySequence:getValue(defaultValue, time)
-	if self.easingCount == 0 then return 0 end
-
-	defaultValue = defaultValue or 0
-	time = time or self.time
-
-	if self.cachedResultTimestamp == time then
-		return self.cachedResult  -- Return cached result if available
-	end
+-- Returns the values stored in a baked sample
+function RoxySequence:getBakeValues(time)
+	return self:getValue(nil, time)
+end
 
-	local clampedTime = Sequence.getClampedTime(time, self.duration, self.loopType)  -- Runs in C (roxy_sequence.c) for optimized performance
+function RoxySequence:clearBake()
+	self.native:clearBake()
+	return self
+end
 
-	local easing = self:getEasingByTime(clampedTime)
-	
-	local result = easing.easeFunction(
-		clampedTime - easing.timestamp,  -- Current time in the easing
-		easing.from,			-- Starting value
-		easing.to - easing.from,  -- Change in value
-		easing.duration			-- Duration of the easing
-	)
-	
-	-- Check for NaN on result
-	if result ~= result then
-		result = defaultValue  -- Fallback to default if result is NaN
-	end
+function RoxySequence:isBaked()
+	return self.native:isBaked()
+end
 
-	self.cachedResultTimestamp = clampedTime
-	self.cachedResult = result
+-- ! Save and Load Baked Tracks
+-- Writes the baked track to a binary file in the game's Data folder
+function RoxySequence:saveBaked(path)
+	return self.native:saveBaked(path)
+end
 
-	return result
+-- Replaces the sequence with a baked track saved by `saveBaked`, checking the Data folder before the game bundle
+function RoxySequence:loadBaked(path)
+	self:clear()
+	self.easingCount = self.native:loadBaked(path)
+	self.channelCount = self.native:getChannelCount()
+	return self.easingCount > 0
 end
 
 -- ! Has Easings
@@ -435,12 +400,16 @@ end
 
 -- ! Get and Set isRunning
 function RoxySequence:getIsRunning()
-	return self.isRunning
+	return self.native:isRunning()  -- Running sequences are the ones in the native pool
 end
 
 function RoxySequence:setIsRunning(_isRunning)
 	if type(_isRunning) == "boolean" then
-		self.isRunning = _isRunning
+		if _isRunning then
+			self:add()
+		else
+			self:remove()
+		end
 	else
 		warn("Warning: Expected a boolean for '_isRunning', but got " .. type(_isRunning))
 	end
@@ -0,0 +1,101 @@
+--
+-- Multi-channel sequence: each keyframe holds several values (e.g. x, y, alpha and scale)
+-- that share the sequence's timing, easings and callbacks.
+--
+
+local Ease <const> = roxy.easingFunctions
+local Time <const> = roxy.time
+
+class("RoxyVectorSequence").extends(RoxySequence)
+
+-- Channels beyond roxy_sequence.h's `ROXY_SEQUENCE_MAX_CHANNELS` are ignored
+function RoxyVectorSequence:init()
+	RoxyVectorSequence.super.init(self)
+	self.channelCount = 1  -- Number of values per keyframe, set by `from`
+end
+
+--! From
+-- Starts the sequence from one value per channel, e.g. `:from(x, y, alpha)`
+function RoxyVectorSequence:from(...)
+	self:clear()  -- Clear previous easings and configurations
+	self.easingCount = self.native:fromValues(...)
+	self.channelCount = self.native:getChannelCount()
+	
+	return self
+end
+
+-- ! To
+-- Eases every channel to its new value. The values come last so any number of channels fits:
+-- `:to(duration, easeFunction, x, y, alpha)`
+function RoxyVectorSequence:to(duration, easeFunction, ...)
+	if self.easingCount == 0 then return self end
+	
+	duration = duration or 0.3
+	easeFunction = easeFunction or Ease.inOutQuad
+	
+	local ease = RoxySequence.resolveEase(easeFunction)
+	self.easingCount = self.native:toValues(duration, ease, ...)
+	if ease == RoxySequence.EASE_LUA then
+		self.luaEasings[self.easingCount] = easeFunction
+	end
+	
+	return self
+end
+
+-- ! Set
+function RoxyVectorSequence:set(...)
+	if self.easingCount == 0 then return self end
+	
+	self.easingCount = self.native:setValues(...)
+	
+	return self
+end
+
+-- ! Get Values
+-- Evaluates a Lua easing function for each (from, to) pair
+local function evaluateLuaEasing(easeFunction, t, d, from, to, ...)
+	if from == nil then return end
+	
+	local result = easeFunction(t, from, to - from, d)
+	if result ~= result then
+		result = from  -- Fallback to the start value if result is NaN
+	end
+	return result, evaluateLuaEasing(easeFunction, t, d, ...)
+end
+
+local function resolveValues(luaEasings, value, ...)
+	if value ~= nil then
+		return value, ...
+	end
+	
+	-- Segments eased by custom Lua functions come back with their easing arguments
+	local index, t, d = ...
+	return evaluateLuaEasing(luaEasings[index], t, d, select(4, ...))
+end
+
+-- Returns the value of every channel at the current time, or at `time`.
+-- Built-in and curve easings are evaluated in C (roxy_sequence.c) in one call.
+function RoxyVectorSequence:getValues(time)
+	return resolveValues(self.luaEasings, self.native:getValues(time))
+end
+
+-- Returns every channel between the last two fixed steps at the render alpha, see `RoxySequence:getInterpolatedValue`
+function RoxyVectorSequence:getInterpolatedValues()
+	local fixedStep = Time.getFixedStep()
+	if fixedStep == 0 or not self.native:isRunning() then
+		return self:getValues()
+	end
+	
+	local time = self.native:getTime() - (1 - Time.getAlpha()) * fixedStep * self.pacing
+	return self:getValues(math.max(time, 0))
+end
+
+-- Returns the values stored in a baked sample
+function RoxyVectorSequence:getBakeValues(time)
+	return self:getValues(time)
+end
+
+-- ! Get Channel Count
+function RoxyVectorSequence:getChannelCount()
+	return self.channelCount
+end
@@ -6,6 +6,7 @@
 #include "roxy_sequence.h"
 #include "../../utilities/roxy_math.h"
 #include <math.h>
+#include <string.h>
 
 // Global variable to hold the Playdate API reference, used throughout this file.
 static PlaydateAPI* pd = NULL;
@@ -15,26 +16,37 @@ void roxy_sequence_setPlaydateAPI(PlaydateAPI* playdate) {
 	pd = playdate;
 }
 
-// Lua binding for getting the clamped time based on the sequence's duration and loop type.
-// Handles three types of sequences: none (clamps the time), loop, and ping-pong.
-int roxy_sequence_getClampedTime_l(lua_State* L) {
-	float time = pd->lua->getArgFloat(1);		// The current time in the sequence.
-	float duration = pd->lua->getArgFloat(2);	// The total duration of the sequence.
-	const char* loopType = pd->lua->getArgString(3);  // The loop type: can be NULL, "loop", or "ping-pong".
+// Per-sequence flags stored in the pool, marking sequences that need more than a time increment
+#define POOL_FLAG_CALLBACKS 0x01	// Has callbacks to check each update
+#define POOL_FLAG_REAL_TIME 0x02	// Measures delta time from the system clock
 
-	float result;		// The clamped or modified time result.
-	int isForward = 1;	// Direction flag for ping-pong sequences, indicates if the time is moving forward or backward.
+// Running sequences, stored as parallel arrays so the update loop walks contiguous memory
+typedef struct {
+	RoxySequence** sequences;
+	float* times;
+	float* durations;
+	float* pacings;
+	uint8_t* loopTypes;
+	uint8_t* flags;
+	int count;
+	int capacity;
+} RoxySequencePool;
 
-	// If no loop type is specified, clamp the time between 0 and the duration.
-	if (loopType == NULL) {
-		result = roxy_math_clamp(time, 0.0f, duration);
-	} 
-	// For loop type, wrap the time around using modulo operation.
-	else if (strcmp(loopType, "loop") == 0) {
+static RoxySequencePool pool = { 0 };
+static RoxySequenceEvents poolEvents = { 0 };	// Events from the last roxy_sequence_updateAll
+static int nextSequenceId = 1;
+
+// Clamps the time based on the sequence's duration and loop type.
+// Handles three types of sequences: none (clamps the time), loop, and ping-pong.
+float roxy_sequence_clampTime(float time, float duration, RoxySequenceLoopType loopType, int* outIsForward) {
+	int isForward = 1;	// Direction flag for ping-pong sequences, indicates if the time is moving forward or backward.
+	float result;		// The clamped or modified time result.
+	
+	if (loopType == kRoxySequenceLoop && duration > 0.0f) {
+		// For loop type, wrap the time around using modulo operation.
 		result = fmodf(time, duration);
-	} 
-	// For ping-pong type, reverse the time after each full cycle to create a back-and-forth effect.
-	else if (strcmp(loopType, "ping-pong") == 0) {
+	} else if (loopType == kRoxySequencePingPong && duration > 0.0f) {
+		// For ping-pong type, reverse the time after each full cycle to create a back-and-forth effect.
 		float doubleDuration = duration * 2.0f;
 		time = fmodf(time, doubleDuration);
 		if (time > duration) {
@@ -42,14 +54,1540 @@ int roxy_sequence_getClampedTime_l(lua_State* L) {
 			time = doubleDuration - time;
 		}
 		result = time;
-	} 
-	// Default behavior: clamp the time if an unknown loop type is provided.
-	else {
+	} else {
+		// If no loop type is specified, clamp the time between 0 and the duration.
 		result = roxy_math_clamp(time, 0.0f, duration);
 	}
+	
+	if (outIsForward != NULL) {
+		*outIsForward = isForward;
+	}
+	return result;
+}
+
+// Reads an optional loop mode argument (roxy.sequence.LOOP_NONE, LOOP or PINGPONG).
+// The "loop" and "ping-pong" strings taken before the constants still work.
+// Nil and unknown values clamp the time, the same as no loop type.
+static RoxySequenceLoopType getLoopTypeArg(int position) {
+	enum LuaType argType = pd->lua->getArgType(position, NULL);
+	if (argType == kTypeNil) {
+		return kRoxySequenceLoopNone;
+	}
+	if (argType == kTypeString) {
+		const char* name = pd->lua->getArgString(position);
+		if (strcmp(name, "loop") == 0) {
+			return kRoxySequenceLoop;
+		} else if (strcmp(name, "ping-pong") == 0) {
+			return kRoxySequencePingPong;
+		}
+		pd->system->logToConsole("Warning: Unknown sequence loop type \"%s\".", name);
+		return kRoxySequenceLoopNone;
+	}
+	int loopType = pd->lua->getArgInt(position);
+	return (loopType == kRoxySequenceLoop || loopType == kRoxySequencePingPong) ? (RoxySequenceLoopType)loopType : kRoxySequenceLoopNone;
+}
+
+// Lua binding for getting the clamped time based on the sequence's duration and loop mode.
+int roxy_sequence_getClampedTime_l(lua_State* L) {
+	(void)L;
+	
+	float time = pd->lua->getArgFloat(1);		// The current time in the sequence.
+	float duration = pd->lua->getArgFloat(2);	// The total duration of the sequence.
+	RoxySequenceLoopType loopType = getLoopTypeArg(3);
+	
+	int isForward;
+	float result = roxy_sequence_clampTime(time, duration, loopType, &isForward);
 
 	// Push the result time and direction flag onto the Lua stack.
 	pd->lua->pushFloat(result);
 	pd->lua->pushBool(isForward);
 	return 2;  // Return two values: the clamped time and the direction flag.
 }
+
+// Lua binding for clamping a start and end time in one call.
+int roxy_sequence_getClampedTimes_l(lua_State* L) {
+	(void)L;
+	
+	float startTime = pd->lua->getArgFloat(1);
+	float endTime = pd->lua->getArgFloat(2);
+	float duration = pd->lua->getArgFloat(3);
+	RoxySequenceLoopType loopType = getLoopTypeArg(4);
+	
+	int isForward;
+	float clampedStart = roxy_sequence_clampTime(startTime, duration, loopType, &isForward);
+	float clampedEnd = roxy_sequence_clampTime(endTime, duration, loopType, NULL);
+	
+	pd->lua->pushFloat(clampedStart);
+	pd->lua->pushFloat(clampedEnd);
+	pd->lua->pushBool(isForward);
+	return 3;  // The clamped start and end times, and the direction at the start time.
+}
+
+// ! Native Sequences
+
+RoxySequence* roxy_sequence_new(void) {
+	RoxySequence* sequence = pd->system->realloc(NULL, sizeof(RoxySequence));
+	if (sequence == NULL) {
+		return NULL;
+	}
+	memset(sequence, 0, sizeof(RoxySequence));
+	sequence->id = nextSequenceId++;
+	sequence->poolIndex = -1;
+	sequence->callbackCursor = -1;
+	sequence->channelCount = 1;
+	sequence->pacing = 1.0f;
+	sequence->easings = pd->system->realloc(NULL, sizeof(RoxySequenceEasing) * ROXY_SEQUENCE_INITIAL_CAPACITY);
+	sequence->easingCapacity = sequence->easings ? ROXY_SEQUENCE_INITIAL_CAPACITY : 0;
+	return sequence;
+}
+
+// Releases the Lua curve objects retained by the sequence's easings
+static void releaseCurves(RoxySequence* sequence) {
+	for (int i = 0; i < sequence->easingCount; ++i) {
+		RoxySequenceEasing* easing = &sequence->easings[i];
+		if (easing->curveObject != NULL) {
+			pd->lua->releaseObject(easing->curveObject);
+			easing->curveObject = NULL;
+		}
+	}
+}
+
+void roxy_sequence_free(RoxySequence* sequence) {
+	if (sequence == NULL) {
+		return;
+	}
+	roxy_sequence_stop(sequence);
+	releaseCurves(sequence);
+	if (sequence->easings != NULL) {
+		pd->system->realloc(sequence->easings, 0);
+	}
+	if (sequence->callbackTimes != NULL) {
+		pd->system->realloc(sequence->callbackTimes, 0);
+	}
+	if (sequence->callbackIndices != NULL) {
+		pd->system->realloc(sequence->callbackIndices, 0);
+	}
+	if (sequence->channelValues != NULL) {
+		pd->system->realloc(sequence->channelValues, 0);
+	}
+	if (sequence->bakedSamples != NULL) {
+		pd->system->realloc(sequence->bakedSamples, 0);
+	}
+	if (sequence->events.values != NULL) {
+		pd->system->realloc(sequence->events.values, 0);
+	}
+	pd->system->realloc(sequence, 0);
+}
+
+// Copies the sequence's settings into its pool slot while it is running
+static void syncPool(const RoxySequence* sequence) {
+	int index = sequence->poolIndex;
+	if (index < 0) {
+		return;
+	}
+	pool.durations[index] = sequence->duration;
+	pool.pacings[index] = sequence->pacing;
+	pool.loopTypes[index] = (uint8_t)sequence->loopType;
+	pool.flags[index] = (sequence->callbackCount > 0 ? POOL_FLAG_CALLBACKS : 0) | (sequence->hasPreviousUpdateTime ? POOL_FLAG_REAL_TIME : 0);
+}
+
+// Resets the sequence's easings, callbacks and runtime state, keeping its allocated capacity and pacing
+void roxy_sequence_clear(RoxySequence* sequence) {
+	releaseCurves(sequence);
+	sequence->easingCount = 0;
+	sequence->channelCount = 1;
+	sequence->callbackCount = 0;
+	sequence->callbackCursor = -1;
+	sequence->duration = 0.0f;
+	sequence->loopType = kRoxySequenceLoopNone;
+	sequence->hasPreviousUpdateTime = 0;
+	sequence->previousUpdateTime = 0;
+	sequence->previousEasingIndex = 0;
+	sequence->hasCachedResult = 0;
+	sequence->bakedSampleCount = 0;
+	roxy_sequence_setTime(sequence, 0.0f);
+	syncPool(sequence);
+}
+
+int roxy_sequence_reserve(RoxySequence* sequence, int easingCapacity) {
+	if (easingCapacity <= sequence->easingCapacity) {
+		return 1;
+	}
+	RoxySequenceEasing* easings = pd->system->realloc(sequence->easings, sizeof(RoxySequenceEasing) * easingCapacity);
+	if (easings == NULL) {
+		pd->system->logToConsole("Warning: Failed to reserve %d sequence easings.", easingCapacity);
+		return 0;
+	}
+	sequence->easings = easings;
+	sequence->easingCapacity = easingCapacity;
+	return 1;
+}
+
+// Number of floats stored per easing for channels 1 and up
+static inline int channelStride(const RoxySequence* sequence) {
+	return (sequence->channelCount - 1) * 2;
+}
+
+// Returns the from values of an easing's extra channels; the to values follow them
+static inline float* channelData(const RoxySequence* sequence, int easingIndex) {
+	return sequence->channelValues + easingIndex * channelStride(sequence);
+}
+
+// Copies the to values of the last easing's extra channels, before adding an easing may move them
+static void copyLastChannels(const RoxySequence* sequence, float* outValues) {
+	int extraCount = sequence->channelCount - 1;
+	if (extraCount > 0) {
+		memcpy(outValues, channelData(sequence, sequence->easingCount - 1) + extraCount, sizeof(float) * extraCount);
+	}
+}
+
+// Appends an easing, growing the easing array as needed.
+// extraFrom and extraTo hold the values of channels 1 and up, and are ignored for single-channel sequences.
+static int addEasing(RoxySequence* sequence, float timestamp, float from, float to, float duration, int ease, RoxyCurve* curve, LuaUDObject* curveObject, const float* extraFrom, const float* extraTo) {
+	int stride = channelStride(sequence);
+	if (stride > 0 && (sequence->easingCount + 1) * stride > sequence->channelValuesCapacity) {
+		int capacity = (sequence->easingCapacity > sequence->easingCount ? sequence->easingCapacity : sequence->easingCount * 2 + 1) * stride;
+		float* channelValues = pd->system->realloc(sequence->channelValues, sizeof(float) * capacity);
+		if (channelValues == NULL) {
+			pd->system->logToConsole("Warning: Failed to grow sequence channels to %d values.", capacity);
+			return sequence->easingCount;
+		}
+		sequence->channelValues = channelValues;
+		sequence->channelValuesCapacity = capacity;
+	}
+	
+	if (sequence->easingCount == sequence->easingCapacity) {
+		int capacity = sequence->easingCapacity > 0 ? sequence->easingCapacity * 2 : ROXY_SEQUENCE_INITIAL_CAPACITY;
+		RoxySequenceEasing* easings = pd->system->realloc(sequence->easings, sizeof(RoxySequenceEasing) * capacity);
+		if (easings == NULL) {
+			pd->system->logToConsole("Warning: Failed to grow sequence to %d easings.", capacity);
+			return sequence->easingCount;
+		}
+		sequence->easings = easings;
+		sequence->easingCapacity = capacity;
+	}
+	
+	if (curveObject != NULL) {
+		pd->lua->retainObject(curveObject);  // Keep the curve alive while the sequence uses it
+	}
+	
+	RoxySequenceEasing* easing = &sequence->easings[sequence->easingCount++];
+	easing->timestamp = timestamp;
+	easing->from = from;
+	easing->to = to;
+	easing->duration = duration;
+	easing->ease = ease;
+	easing->curve = curve;
+	easing->curveObject = curveObject;
+	
+	if (stride > 0) {
+		int extraCount = stride / 2;
+		float* data = channelData(sequence, sequence->easingCount - 1);
+		memcpy(data, extraFrom, sizeof(float) * extraCount);
+		memcpy(data + extraCount, extraTo, sizeof(float) * extraCount);
+	}
+	
+	sequence->hasCachedResult = 0;
+	sequence->bakedSampleCount = 0;  // Any baked track no longer matches the easings
+	return sequence->easingCount;
+}
+
+static inline const RoxySequenceEasing* lastEasing(const RoxySequence* sequence) {
+	return &sequence->easings[sequence->easingCount - 1];
+}
+
+int roxy_sequence_from(RoxySequence* sequence, float from) {
+	roxy_sequence_clear(sequence);
+	return addEasing(sequence, 0.0f, from, from, 0.0f, kRoxyEaseFlat, NULL, NULL, NULL, NULL);
+}
+
+int roxy_sequence_fromValues(RoxySequence* sequence, const float* values, int channelCount) {
+	roxy_sequence_clear(sequence);
+	sequence->channelCount = (int)roxy_math_clamp((float)channelCount, 1.0f, (float)ROXY_SEQUENCE_MAX_CHANNELS);
+	return addEasing(sequence, 0.0f, values[0], values[0], 0.0f, kRoxyEaseFlat, NULL, NULL, values + 1, values + 1);
+}
+
+int roxy_sequence_to(RoxySequence* sequence, float to, float duration, int ease, RoxyCurve* curve, LuaUDObject* curveObject) {
+	if (sequence->easingCount == 0) {
+		return 0;
+	}
+	float extra[ROXY_SEQUENCE_MAX_CHANNELS];
+	copyLastChannels(sequence, extra);
+	const RoxySequenceEasing* last = lastEasing(sequence);
+	int count = addEasing(sequence, last->timestamp + last->duration, last->to, to, duration, ease, curve, curveObject, extra, extra);
+	sequence->duration += duration;
+	syncPool(sequence);
+	return count;
+}
+
+int roxy_sequence_toValues(RoxySequence* sequence, const float* values, float duration, int ease, RoxyCurve* curve, LuaUDObject* curveObject) {
+	if (sequence->easingCount == 0) {
+		return 0;
+	}
+	float extra[ROXY_SEQUENCE_MAX_CHANNELS];
+	copyLastChannels(sequence, extra);
+	const RoxySequenceEasing* last = lastEasing(sequence);
+	int count = addEasing(sequence, last->timestamp + last->duration, last->to, values[0], duration, ease, curve, curveObject, extra, values + 1);
+	sequence->duration += duration;
+	syncPool(sequence);
+	return count;
+}
+
+int roxy_sequence_set(RoxySequence* sequence, float value) {
+	if (sequence->easingCount == 0) {
+		return 0;
+	}
+	float extra[ROXY_SEQUENCE_MAX_CHANNELS];
+	copyLastChannels(sequence, extra);
+	const RoxySequenceEasing* last = lastEasing(sequence);
+	return addEasing(sequence, last->timestamp + last->duration, value, value, 0.0f, kRoxyEaseFlat, NULL, NULL, extra, extra);
+}
+
+int roxy_sequence_setValues(RoxySequence* sequence, const float* values) {
+	if (sequence->easingCount == 0) {
+		return 0;
+	}
+	const RoxySequenceEasing* last = lastEasing(sequence);
+	return addEasing(sequence, last->timestamp + last->duration, values[0], values[0], 0.0f, kRoxyEaseFlat, NULL, NULL, values + 1, values + 1);
+}
+
+// Repeats the last easing, swapping its values on each repeat when pingPong is set
+int roxy_sequence_again(RoxySequence* sequence, int repeatCount, int pingPong) {
+	if (sequence->easingCount == 0) {
+		return 0;
+	}
+	int extraCount = sequence->channelCount - 1;
+	for (int i = 0; i < repeatCount; ++i) {
+		// Copied, since adding may move the arrays
+		RoxySequenceEasing previous = *lastEasing(sequence);
+		float extra[ROXY_SEQUENCE_MAX_CHANNELS * 2];
+		if (extraCount > 0) {
+			memcpy(extra, channelData(sequence, sequence->easingCount - 1), sizeof(float) * extraCount * 2);
+		}
+		float* extraFrom = extra;
+		float* extraTo = extra + extraCount;
+		
+		float from = pingPong ? previous.to : previous.from;
+		float to = pingPong ? previous.from : previous.to;
+		addEasing(sequence, previous.timestamp + previous.duration, from, to, previous.duration, previous.ease, previous.curve, previous.curveObject, pingPong ? extraTo : extraFrom, pingPong ? extraFrom : extraTo);
+		sequence->duration += previous.duration;
+	}
+	syncPool(sequence);
+	return sequence->easingCount;
+}
+
+int roxy_sequence_sleep(RoxySequence* sequence, float duration) {
+	if (sequence->easingCount == 0 || duration == 0.0f) {
+		return sequence->easingCount;
+	}
+	float extra[ROXY_SEQUENCE_MAX_CHANNELS];
+	copyLastChannels(sequence, extra);
+	const RoxySequenceEasing* last = lastEasing(sequence);
+	int count = addEasing(sequence, last->timestamp + last->duration, last->to, last->to, duration, kRoxyEaseFlat, NULL, NULL, extra, extra);
+	sequence->duration += duration;
+	syncPool(sequence);
+	return count;
+}
+
+// Reverses the order of the easings in place, swapping their start and end values
+void roxy_sequence_reverse(RoxySequence* sequence) {
+	int count = sequence->easingCount;
+	for (int i = 0; i < count / 2; ++i) {
+		RoxySequenceEasing temp = sequence->easings[i];
+		sequence->easings[i] = sequence->easings[count - 1 - i];
+		sequence->easings[count - 1 - i] = temp;
+	}
+	for (int i = 0; i < count; ++i) {
+		RoxySequenceEasing* easing = &sequence->easings[i];
+		float from = easing->from;
+		easing->timestamp = sequence->duration - (easing->timestamp + easing->duration);
+		easing->from = easing->to;
+		easing->to = from;
+	}
+	
+	// Reverse the extra channels the same way
+	int stride = channelStride(sequence);
+	if (stride > 0) {
+		int extraCount = stride / 2;
+		float temp[ROXY_SEQUENCE_MAX_CHANNELS * 2];
+		for (int i = 0; i < count / 2; ++i) {
+			memcpy(temp, channelData(sequence, i), sizeof(float) * stride);
+			memcpy(channelData(sequence, i), channelData(sequence, count - 1 - i), sizeof(float) * stride);
+			memcpy(channelData(sequence, count - 1 - i), temp, sizeof(float) * stride);
+		}
+		for (int i = 0; i < count; ++i) {
+			float* data = channelData(sequence, i);
+			memcpy(temp, data, sizeof(float) * extraCount);
+			memmove(data, data + extraCount, sizeof(float) * extraCount);
+			memcpy(data + extraCount, temp, sizeof(float) * extraCount);
+		}
+	}
+	sequence->previousEasingIndex = 0;
+	sequence->hasCachedResult = 0;
+	sequence->bakedSampleCount = 0;
+}
+
+int roxy_sequence_addCallback(RoxySequence* sequence, float timestamp) {
+	if (sequence->callbackCount == sequence->callbackCapacity) {
+		int capacity = sequence->callbackCapacity > 0 ? sequence->callbackCapacity * 2 : 4;
+		float* callbackTimes = pd->system->realloc(sequence->callbackTimes, sizeof(float) * capacity);
+		if (callbackTimes != NULL) {
+			sequence->callbackTimes = callbackTimes;
+		}
+		int* callbackIndices = pd->system->realloc(sequence->callbackIndices, sizeof(int) * capacity);
+		if (callbackIndices != NULL) {
+			sequence->callbackIndices = callbackIndices;
+		}
+		if (callbackTimes == NULL || callbackIndices == NULL) {
+			pd->system->logToConsole("Warning: Failed to grow sequence to %d callbacks.", capacity);
+			return 0;
+		}
+		sequence->callbackCapacity = capacity;
+	}
+	
+	// Insert after callbacks with the same timestamp, so they fire in the order they were added
+	int position = sequence->callbackCount;
+	while (position > 0 && sequence->callbackTimes[position - 1] > timestamp) {
+		sequence->callbackTimes[position] = sequence->callbackTimes[position - 1];
+		sequence->callbackIndices[position] = sequence->callbackIndices[position - 1];
+		--position;
+	}
+	int index = ++sequence->callbackCount;
+	sequence->callbackTimes[position] = timestamp;
+	sequence->callbackIndices[position] = index;
+	sequence->callbackCursor = -1;
+	syncPool(sequence);
+	return index;
+}
+
+void roxy_sequence_setPacing(RoxySequence* sequence, float pacing) {
+	sequence->pacing = pacing;
+	syncPool(sequence);
+}
+
+void roxy_sequence_setPreviousUpdateTime(RoxySequence* sequence, unsigned int currentTime) {
+	sequence->previousUpdateTime = currentTime;
+	sequence->hasPreviousUpdateTime = 1;
+	syncPool(sequence);
+}
+
+float roxy_sequence_getTime(const RoxySequence* sequence) {
+	return sequence->poolIndex >= 0 ? pool.times[sequence->poolIndex] : sequence->time;
+}
+
+void roxy_sequence_setTime(RoxySequence* sequence, float time) {
+	if (sequence->poolIndex >= 0) {
+		pool.times[sequence->poolIndex] = time;
+	}
+	sequence->time = time;
+}
+
+// Appends an (id, event) pair, growing the event list as needed
+static void pushEvent(RoxySequenceEvents* events, int id, int event) {
+	if (events->count + 2 > events->capacity) {
+		int capacity = events->capacity > 0 ? events->capacity * 2 : ROXY_SEQUENCE_MAX_EVENTS_PER_CALL * 2;
+		int* values = pd->system->realloc(events->values, sizeof(int) * capacity);
+		if (values == NULL) {
+			pd->system->logToConsole("Warning: Failed to grow sequence events to %d.", capacity);
+			return;
+		}
+		events->values = values;
+		events->capacity = capacity;
+	}
+	events->values[events->count++] = id;
+	events->values[events->count++] = event;
+}
+
+// Returns the number of callbacks before a time; when inclusive, callbacks at the time are counted too
+static int findCallback(const RoxySequence* sequence, float time, int inclusive) {
+	int startIndex = 0;
+	int endIndex = sequence->callbackCount;
+	while (startIndex < endIndex) {
+		int middleIndex = (startIndex + endIndex) / 2;
+		float timestamp = sequence->callbackTimes[middleIndex];
+		if (timestamp < time || (inclusive && timestamp == time)) {
+			startIndex = middleIndex + 1;
+		} else {
+			endIndex = middleIndex;
+		}
+	}
+	return startIndex;
+}
+
+// Fires callbacks forward from the cursor, up to endTime
+static void fireForward(RoxySequence* sequence, float endTime, int inclusive, RoxySequenceEvents* events) {
+	int cursor = sequence->callbackCursor;
+	while (cursor < sequence->callbackCount) {
+		float timestamp = sequence->callbackTimes[cursor];
+		if (timestamp > endTime || (!inclusive && timestamp == endTime)) {
+			break;
+		}
+		pushEvent(events, sequence->id, sequence->callbackIndices[cursor++]);
+	}
+	sequence->callbackCursor = cursor;
+}
+
+// Fires callbacks backward from the cursor, down to and including endTime
+static void fireBackward(RoxySequence* sequence, float endTime, RoxySequenceEvents* events) {
+	int cursor = sequence->callbackCursor;
+	while (cursor > 0 && sequence->callbackTimes[cursor - 1] >= endTime) {
+		pushEvent(events, sequence->id, sequence->callbackIndices[--cursor]);
+	}
+	sequence->callbackCursor = cursor;
+}
+
+// Queues the callbacks passed while advancing from time by deltaTime, following the loop type.
+// The cursor only moves over callbacks that fire, so the cost is proportional to the fired callbacks.
+static void collectCallbacks(RoxySequence* sequence, float time, float deltaTime, float duration, RoxySequenceLoopType loopType, RoxySequenceEvents* events) {
+	int isForward;
+	float clampedTime = roxy_sequence_clampTime(time, duration, loopType, &isForward);
+	
+	// Find the cursor again after the time was set, or callbacks were added
+	if (sequence->callbackCursor < 0 || sequence->callbackSyncTime != time) {
+		sequence->callbackCursor = findCallback(sequence, clampedTime, 0);
+	}
+	sequence->callbackSyncTime = time + deltaTime;
+	
+	if (deltaTime <= 0.0f) {
+		return;
+	}
+	
+	// Handle no loop scenario; the last update also fires callbacks at the very end
+	if (loopType == kRoxySequenceLoopNone || duration <= 0.0f) {
+		fireForward(sequence, clampedTime + deltaTime, time + deltaTime >= duration, events);
+		return;
+	}
+	
+	// A full cycle or more fires every callback once, leaving the cursor where it started
+	float cycleDuration = loopType == kRoxySequencePingPong ? duration * 2.0f : duration;
+	if (deltaTime >= cycleDuration) {
+		for (int i = 0; i < sequence->callbackCount; ++i) {
+			pushEvent(events, sequence->id, sequence->callbackIndices[i]);
+		}
+		deltaTime = fmodf(deltaTime, cycleDuration);
+	}
+	
+	// Handle loop scenarios, walking across at most two wraps or turns
+	float position = clampedTime;
+	float remaining = deltaTime;
+	while (remaining > 0.0f) {
+		if (isForward) {
+			float room = duration - position;
+			if (remaining < room) {
+				fireForward(sequence, position + remaining, 0, events);
+				break;
+			}
+			fireForward(sequence, duration, 1, events);
+			remaining -= room;
+			
+			if (loopType == kRoxySequenceLoop) {
+				sequence->callbackCursor = 0;
+				position = 0.0f;
+			} else {
+				// Turn around without firing callbacks at the end a second time
+				sequence->callbackCursor = findCallback(sequence, duration, 0);
+				position = duration;
+				isForward = 0;
+			}
+		} else {
+			if (remaining < position) {
+				fireBackward(sequence, position - remaining, events);
+				break;
+			}
+			fireBackward(sequence, 0.0f, events);
+			remaining -= position;
+			
+			// Turn around without firing callbacks at the start a second time
+			sequence->callbackCursor = findCallback(sequence, 0.0f, 1);
+			position = 0.0f;
+			isForward = 1;
+		}
+	}
+}
+
+// Returns the unpaced delta time, measured from the system clock when the sequence uses real time
+static float getDeltaTime(RoxySequence* sequence, float deltaTime) {
+	if (sequence->hasPreviousUpdateTime) {
+		unsigned int currentTime = pd->system->getCurrentTimeMilliseconds();
+		deltaTime = (float)(currentTime - sequence->previousUpdateTime) / 1000.0f;
+		sequence->previousUpdateTime = currentTime;
+	}
+	return deltaTime;
+}
+
+void roxy_sequence_update(RoxySequence* sequence, float deltaTime, RoxySequenceEvents* outEvents) {
+	deltaTime = getDeltaTime(sequence, deltaTime) * sequence->pacing;
+	float time = roxy_sequence_getTime(sequence);
+	
+	if (outEvents != NULL && sequence->callbackCount > 0 && sequence->easingCount > 0) {
+		collectCallbacks(sequence, time, deltaTime, sequence->duration, sequence->loopType, outEvents);
+	}
+	roxy_sequence_setTime(sequence, time + deltaTime);
+}
+
+int roxy_sequence_isDone(const RoxySequence* sequence) {
+	return roxy_sequence_getTime(sequence) >= sequence->duration && sequence->loopType == kRoxySequenceLoopNone;
+}
+
+// ! Sequence Pool
+
+static int growPool(int capacity) {
+	RoxySequence** sequences = pd->system->realloc(pool.sequences, sizeof(RoxySequence*) * capacity);
+	if (sequences != NULL) pool.sequences = sequences;
+	float* times = pd->system->realloc(pool.times, sizeof(float) * capacity);
+	if (times != NULL) pool.times = times;
+	float* durations = pd->system->realloc(pool.durations, sizeof(float) * capacity);
+	if (durations != NULL) pool.durations = durations;
+	float* pacings = pd->system->realloc(pool.pacings, sizeof(float) * capacity);
+	if (pacings != NULL) pool.pacings = pacings;
+	uint8_t* loopTypes = pd->system->realloc(pool.loopTypes, sizeof(uint8_t) * capacity);
+	if (loopTypes != NULL) pool.loopTypes = loopTypes;
+	uint8_t* flags = pd->system->realloc(pool.flags, sizeof(uint8_t) * capacity);
+	if (flags != NULL) pool.flags = flags;
+	
+	if (sequences == NULL || times == NULL || durations == NULL || pacings == NULL || loopTypes == NULL || flags == NULL) {
+		pd->system->logToConsole("Warning: Failed to grow sequence pool to %d sequences.", capacity);
+		return 0;
+	}
+	pool.capacity = capacity;
+	return 1;
+}
+
+// Swap-removes a pool slot, writing its time back to the sequence
+static void removeFromPool(int index) {
+	RoxySequence* sequence = pool.sequences[index];
+	sequence->time = pool.times[index];
+	sequence->poolIndex = -1;
+	
+	int last = --pool.count;
+	if (index != last) {
+		pool.sequences[index] = pool.sequences[last];
+		pool.times[index] = pool.times[last];
+		pool.durations[index] = pool.durations[last];
+		pool.pacings[index] = pool.pacings[last];
+		pool.loopTypes[index] = pool.loopTypes[last];
+		pool.flags[index] = pool.flags[last];
+		pool.sequences[index]->poolIndex = index;
+	}
+}
+
+void roxy_sequence_start(RoxySequence* sequence) {
+	if (sequence->poolIndex >= 0 || sequence->easingCount == 0) {
+		return;
+	}
+	if (pool.count == pool.capacity && !growPool(pool.capacity > 0 ? pool.capacity * 2 : ROXY_SEQUENCE_POOL_INITIAL_CAPACITY)) {
+		return;
+	}
+	
+	int index = pool.count++;
+	pool.sequences[index] = sequence;
+	pool.times[index] = sequence->time;
+	sequence->poolIndex = index;
+	syncPool(sequence);
+}
+
+void roxy_sequence_stop(RoxySequence* sequence) {
+	if (sequence->poolIndex >= 0) {
+		removeFromPool(sequence->poolIndex);
+	}
+}
+
+int roxy_sequence_isRunning(const RoxySequence* sequence) {
+	return sequence->poolIndex >= 0;
+}
+
+void roxy_sequence_stopAll(void) {
+	while (pool.count > 0) {
+		removeFromPool(pool.count - 1);
+	}
+}
+
+void roxy_sequence_updateAll(float deltaTime) {
+	poolEvents.count = 0;
+	poolEvents.readIndex = 0;
+	
+	// Walk backward so swap-removal only moves sequences that were already updated
+	for (int i = pool.count - 1; i >= 0; --i) {
+		float pacedDeltaTime = deltaTime * pool.pacings[i];
+		
+		uint8_t flags = pool.flags[i];
+		if (flags != 0) {
+			RoxySequence* sequence = pool.sequences[i];
+			if (flags & POOL_FLAG_REAL_TIME) {
+				pacedDeltaTime = getDeltaTime(sequence, deltaTime) * pool.pacings[i];
+			}
+			if (flags & POOL_FLAG_CALLBACKS) {
+				collectCallbacks(sequence, pool.times[i], pacedDeltaTime, pool.durations[i], (RoxySequenceLoopType)pool.loopTypes[i], &poolEvents);
+			}
+		}
+		
+		pool.times[i] += pacedDeltaTime;
+		
+		if (pool.loopTypes[i] == kRoxySequenceLoopNone && pool.times[i] >= pool.durations[i]) {
+			int id = pool.sequences[i]->id;
+			removeFromPool(i);
+			pushEvent(&poolEvents, id, ROXY_SEQUENCE_EVENT_FINISHED);  // Queued after the sequence's callbacks
+		}
+	}
+}
+
+int roxy_sequence_getRunningCount(void) {
+	return pool.count;
+}
+
+int roxy_sequence_reservePool(int capacity) {
+	return capacity <= pool.capacity || growPool(capacity);
+}
+
+const RoxySequenceEasing* roxy_sequence_getEasingByTime(RoxySequence* sequence, float clampedTime) {
+	if (sequence->easingCount == 0) {
+		return NULL;
+	}
+	
+	// Consecutive frames usually stay within the same easing
+	const RoxySequenceEasing* previous = &sequence->easings[sequence->previousEasingIndex];
+	if (clampedTime >= previous->timestamp && clampedTime <= previous->timestamp + previous->duration) {
+		return previous;
+	}
+	
+	int startIndex = 0;
+	int endIndex = sequence->easingCount - 1;
+	while (startIndex <= endIndex) {
+		int middleIndex = (startIndex + endIndex) / 2;
+		const RoxySequenceEasing* easing = &sequence->easings[middleIndex];
+		
+		if (clampedTime < easing->timestamp) {
+			endIndex = middleIndex - 1;
+		} else if (clampedTime > easing->timestamp + easing->duration) {
+			startIndex = middleIndex + 1;
+		} else {
+			sequence->previousEasingIndex = middleIndex;
+			return easing;
+		}
+	}
+	
+	return &sequence->easings[0];  // Default to the first easing if not found
+}
+
+// Evaluates an easing's function for one channel
+static inline float evaluateEase(const RoxySequenceEasing* easing, float t, float from, float to) {
+	if (easing->ease == ROXY_SEQUENCE_EASE_CURVE) {
+		return roxy_curve_ease(easing->curve, t, from, to - from, easing->duration);
+	}
+	if (easing->ease < 0) {
+		return from;
+	}
+	return roxy_ease_evaluate((RoxyEaseType)easing->ease, t, from, to - from, easing->duration);
+}
+
+float roxy_sequence_evaluateEasing(const RoxySequenceEasing* easing, float clampedTime) {
+	return evaluateEase(easing, clampedTime - easing->timestamp, easing->from, easing->to);
+}
+
+int roxy_sequence_evaluateValues(RoxySequence* sequence, float clampedTime, float* outValues) {
+	const RoxySequenceEasing* easing = roxy_sequence_getEasingByTime(sequence, clampedTime);
+	if (easing == NULL || easing->ease == ROXY_SEQUENCE_EASE_LUA) {
+		return 0;
+	}
+	
+	float t = clampedTime - easing->timestamp;
+	outValues[0] = evaluateEase(easing, t, easing->from, easing->to);
+	
+	int extraCount = sequence->channelCount - 1;
+	if (extraCount > 0) {
+		const float* data = channelData(sequence, (int)(easing - sequence->easings));
+		for (int i = 0; i < extraCount; ++i) {
+			outValues[i + 1] = evaluateEase(easing, t, data[i], data[extraCount + i]);
+		}
+	}
+	return sequence->channelCount;
+}
+
+// ! Baked Tracks
+
+int roxy_sequence_beginBake(RoxySequence* sequence, int sampleCount) {
+	sequence->bakedSampleCount = 0;
+	if (sampleCount < 2 || sampleCount > ROXY_SEQUENCE_MAX_BAKED_SAMPLES) {
+		pd->system->logToConsole("Warning: Baked tracks need 2 to %d samples, got %d.", ROXY_SEQUENCE_MAX_BAKED_SAMPLES, sampleCount);
+		return 0;
+	}
+	
+	int capacity = sampleCount * sequence->channelCount;
+	if (capacity > sequence->bakedSampleCapacity) {
+		float* samples = pd->system->realloc(sequence->bakedSamples, sizeof(float) * capacity);
+		if (samples == NULL) {
+			pd->system->logToConsole("Warning: Failed to allocate a baked track of %d samples.", sampleCount);
+			return 0;
+		}
+		sequence->bakedSamples = samples;
+		sequence->bakedSampleCapacity = capacity;
+	}
+	
+	memset(sequence->bakedSamples, 0, sizeof(float) * capacity);
+	sequence->bakedSampleCount = sampleCount;
+	sequence->bakedScale = sequence->duration > 0.0f ? (float)(sampleCount - 1) / sequence->duration : 0.0f;
+	return 1;
+}
+
+void roxy_sequence_setBakedSample(RoxySequence* sequence, int index, const float* values) {
+	if (index < 0 || index >= sequence->bakedSampleCount) {
+		return;
+	}
+	memcpy(sequence->bakedSamples + index * sequence->channelCount, values, sizeof(float) * sequence->channelCount);
+}
+
+int roxy_sequence_bake(RoxySequence* sequence, float sampleRate) {
+	roxy_sequence_clearBake(sequence);  // A failed bake must not leave the previous track in place
+	if (sequence->easingCount == 0 || sampleRate <= 0.0f) {
+		return 0;
+	}
+	for (int i = 0; i < sequence->easingCount; ++i) {
+		if (sequence->easings[i].ease == ROXY_SEQUENCE_EASE_LUA) {
+			return 0;
+		}
+	}
+	
+	int sampleCount = (int)ceilf(sequence->duration * sampleRate) + 1;
+	if (sampleCount < 2) {
+		sampleCount = 2;
+	}
+	
+	if (!roxy_sequence_beginBake(sequence, sampleCount)) {
+		return 0;
+	}
+	
+	float values[ROXY_SEQUENCE_MAX_CHANNELS];
+	float step = sequence->duration / (float)(sampleCount - 1);
+	for (int i = 0; i < sampleCount; ++i) {
+		float time = i == sampleCount - 1 ? sequence->duration : step * (float)i;
+		roxy_sequence_evaluateValues(sequence, time, values);
+		memcpy(sequence->bakedSamples + i * sequence->channelCount, values, sizeof(float) * sequence->channelCount);
+	}
+	
+	sequence->hasCachedResult = 0;
+	return 1;
+}
+
+void roxy_sequence_clearBake(RoxySequence* sequence) {
+	sequence->bakedSampleCount = 0;
+	sequence->hasCachedResult = 0;
+}
+
+int roxy_sequence_isBaked(const RoxySequence* sequence) {
+	return sequence->bakedSampleCount > 0;
+}
+
+void roxy_sequence_evaluateBaked(const RoxySequence* sequence, float clampedTime, float* outValues) {
+	int channelCount = sequence->channelCount;
+	int lastIndex = sequence->bakedSampleCount - 1;
+	
+	float position = clampedTime * sequence->bakedScale;
+	int index = (int)position;
+	if (index < 0) {
+		index = 0;
+		position = 0.0f;
+	} else if (index >= lastIndex) {
+		memcpy(outValues, sequence->bakedSamples + lastIndex * channelCount, sizeof(float) * channelCount);
+		return;
+	}
+	
+	float fraction = position - (float)index;
+	const float* a = sequence->bakedSamples + index * channelCount;
+	const float* b = a + channelCount;
+	for (int i = 0; i < channelCount; ++i) {
+		outValues[i] = a[i] + (b[i] - a[i]) * fraction;
+	}
+}
+
+// Baked track file header, followed by sampleCount * channelCount floats
+typedef struct {
+	char magic[4];
+	int32_t version;
+	int32_t channelCount;
+	int32_t sampleCount;
+	float duration;
+} RoxyBakedHeader;
+
+int roxy_sequence_saveBaked(const RoxySequence* sequence, const char* path) {
+	if (sequence->bakedSampleCount == 0) {
+		pd->system->logToConsole("Warning: Sequence has no baked track to save to %s.", path);
+		return 0;
+	}
+	
+	SDFile* file = pd->file->open(path, kFileWrite);
+	if (file == NULL) {
+		pd->system->logToConsole("Warning: Failed to open %s for writing, %s", path, pd->file->geterr());
+		return 0;
+	}
+	
+	RoxyBakedHeader header;
+	memcpy(header.magic, ROXY_SEQUENCE_BAKED_MAGIC, sizeof(header.magic));
+	header.version = ROXY_SEQUENCE_BAKED_VERSION;
+	header.channelCount = sequence->channelCount;
+	header.sampleCount = sequence->bakedSampleCount;
+	header.duration = sequence->duration;
+	
+	unsigned int dataSize = sizeof(float) * sequence->bakedSampleCount * sequence->channelCount;
+	int success = pd->file->write(file, &header, sizeof(header)) == (int)sizeof(header)
+		&& pd->file->write(file, sequence->bakedSamples, dataSize) == (int)dataSize;
+	pd->file->close(file);
+	
+	if (!success) {
+		pd->system->logToConsole("Warning: Failed to write baked track to %s.", path);
+	}
+	return success;
+}
+
+int roxy_sequence_loadBaked(RoxySequence* sequence, const char* path) {
+	SDFile* file = pd->file->open(path, kFileReadData | kFileRead);
+	if (file == NULL) {
+		pd->system->logToConsole("Warning: Failed to open %s, %s", path, pd->file->geterr());
+		return 0;
+	}
+	
+	RoxyBakedHeader header;
+	if (pd->file->read(file, &header, sizeof(header)) != (int)sizeof(header)
+		|| memcmp(header.magic, ROXY_SEQUENCE_BAKED_MAGIC, sizeof(header.magic)) != 0
+		|| header.version != ROXY_SEQUENCE_BAKED_VERSION
+		|| header.channelCount < 1 || header.channelCount > ROXY_SEQUENCE_MAX_CHANNELS
+		|| header.sampleCount < 2 || header.sampleCount > ROXY_SEQUENCE_MAX_BAKED_SAMPLES) {
+		pd->system->logToConsole("Warning: %s is not a baked sequence track.", path);
+		pd->file->close(file);
+		return 0;
+	}
+	
+	// Stand-in easing from the first to the last sample, used if the track is dropped later
+	roxy_sequence_clear(sequence);
+	sequence->channelCount = header.channelCount;
+	float first[ROXY_SEQUENCE_MAX_CHANNELS] = { 0 };
+	float last[ROXY_SEQUENCE_MAX_CHANNELS] = { 0 };
+	
+	int success = roxy_sequence_beginBake(sequence, header.sampleCount);
+	unsigned int dataSize = sizeof(float) * header.sampleCount * header.channelCount;
+	if (success && pd->file->read(file, sequence->bakedSamples, dataSize) != (int)dataSize) {
+		pd->system->logToConsole("Warning: %s is shorter than its header says.", path);
+		success = 0;
+	}
+	pd->file->close(file);
+	if (!success) {
+		roxy_sequence_clear(sequence);
+		return 0;
+	}
+	
+	memcpy(first, sequence->bakedSamples, sizeof(float) * header.channelCount);
+	memcpy(last, sequence->bakedSamples + (header.sampleCount - 1) * header.channelCount, sizeof(float) * header.channelCount);
+	
+	// Adding the easings drops the track, so it is restored afterward
+	int sampleCount = header.sampleCount;
+	addEasing(sequence, 0.0f, first[0], first[0], 0.0f, kRoxyEaseFlat, NULL, NULL, first + 1, first + 1);
+	addEasing(sequence, 0.0f, first[0], last[0], header.duration, kRoxyEaseLinear, NULL, NULL, first + 1, last + 1);
+	sequence->duration = header.duration;
+	sequence->bakedSampleCount = sampleCount;
+	sequence->bakedScale = header.duration > 0.0f ? (float)(sampleCount - 1) / header.duration : 0.0f;
+	syncPool(sequence);
+	return 1;
+}
+
+// ! Lua Bindings
+
+static RoxySequence* getSequenceArg(int position) {
+	return pd->lua->getArgObject(position, ROXY_SEQUENCE_CLASS, NULL);
+}
+
+int roxy_sequence_new_l(lua_State* L) {
+	(void)L;
+	
+	RoxySequence* sequence = roxy_sequence_new();
+	if (sequence == NULL) {
+		pd->system->logToConsole("Warning: Failed to create native sequence.");
+		pd->lua->pushNil();
+		return 1;
+	}
+	pd->lua->pushObject(sequence, ROXY_SEQUENCE_CLASS, 0);
+	return 1;
+}
+
+// Pushes up to ROXY_SEQUENCE_MAX_EVENTS_PER_CALL pool events, preceded by whether more remain
+static int pushPoolEvents(void) {
+	int remaining = (poolEvents.count - poolEvents.readIndex) / 2;
+	int count = remaining < ROXY_SEQUENCE_MAX_EVENTS_PER_CALL ? remaining : ROXY_SEQUENCE_MAX_EVENTS_PER_CALL;
+	
+	pd->lua->pushBool(remaining > count);
+	for (int i = 0; i < count * 2; ++i) {
+		pd->lua->pushInt(poolEvents.values[poolEvents.readIndex++]);
+	}
+	return 1 + count * 2;
+}
+
+int roxy_sequence_updateAll_l(lua_State* L) {
+	(void)L;
+	
+	roxy_sequence_updateAll(pd->lua->getArgFloat(1));
+	return pushPoolEvents();
+}
+
+int roxy_sequence_popEvents_l(lua_State* L) {
+	(void)L;
+	
+	return pushPoolEvents();
+}
+
+int roxy_sequence_stopAll_l(lua_State* L) {
+	(void)L;
+	
+	roxy_sequence_stopAll();
+	return 0;
+}
+
+int roxy_sequence_getRunningCount_l(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushInt(roxy_sequence_getRunningCount());
+	return 1;
+}
+
+int roxy_sequence_reservePool_l(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushBool(roxy_sequence_reservePool(pd->lua->getArgInt(1)));
+	return 1;
+}
+
+static int sequence_gc(lua_State* L) {
+	(void)L;
+	
+	roxy_sequence_free(getSequenceArg(1));
+	return 0;
+}
+
+static int sequence_clear(lua_State* L) {
+	(void)L;
+	
+	roxy_sequence_clear(getSequenceArg(1));
+	return 0;
+}
+
+// sequence:reserve(easingCapacity) -> success
+static int sequence_reserve(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushBool(roxy_sequence_reserve(getSequenceArg(1), pd->lua->getArgInt(2)));
+	return 1;
+}
+
+// sequence:from(value) -> easingCount
+static int sequence_from(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushInt(roxy_sequence_from(getSequenceArg(1), pd->lua->getArgFloat(2)));
+	return 1;
+}
+
+// Reads an easing argument: a RoxyEaseType, a roxy.curve, or ROXY_SEQUENCE_EASE_LUA for a Lua easing function.
+// Anything else eases with inOutQuad.
+static int getEaseArg(int position, RoxyCurve** outCurve, LuaUDObject** outCurveObject) {
+	*outCurve = NULL;
+	*outCurveObject = NULL;
+	
+	enum LuaType easeType = pd->lua->getArgType(position, NULL);
+	if (easeType == kTypeObject) {
+		LuaUDObject* curveObject = NULL;
+		RoxyCurve* curve = pd->lua->getArgObject(position, ROXY_CURVE_CLASS, &curveObject);
+		if (curve != NULL) {
+			*outCurve = curve;
+			*outCurveObject = curveObject;
+			return ROXY_SEQUENCE_EASE_CURVE;
+		}
+	} else if (easeType == kTypeInt || easeType == kTypeFloat) {
+		int ease = pd->lua->getArgInt(position);
+		if (ease < kRoxyEaseCount && ease >= ROXY_SEQUENCE_EASE_LUA) {
+			return ease;
+		}
+	}
+	return kRoxyEaseInOutQuad;
+}
+
+// Reads up to ROXY_SEQUENCE_MAX_CHANNELS values starting at an argument position, returning how many were read
+static int getValueArgs(int position, float* outValues) {
+	int count = pd->lua->getArgCount() - position + 1;
+	if (count > ROXY_SEQUENCE_MAX_CHANNELS) {
+		count = ROXY_SEQUENCE_MAX_CHANNELS;
+	}
+	for (int i = 0; i < count; ++i) {
+		outValues[i] = pd->lua->getArgFloat(position + i);
+	}
+	return count > 0 ? count : 0;
+}
+
+// sequence:to(value, duration, ease) -> easingCount
+static int sequence_to(lua_State* L) {
+	(void)L;
+	
+	RoxySequence* sequence = getSequenceArg(1);
+	float to = pd->lua->getArgFloat(2);
+	float duration = pd->lua->getArgFloat(3);
+	
+	RoxyCurve* curve;
+	LuaUDObject* curveObject;
+	int ease = getEaseArg(4, &curve, &curveObject);
+	
+	pd->lua->pushInt(roxy_sequence_to(sequence, to, duration, ease, curve, curveObject));
+	return 1;
+}
+
+// sequence:fromValues(value1, value2, ...) -> easingCount
+static int sequence_fromValues(lua_State* L) {
+	(void)L;
+	
+	RoxySequence* sequence = getSequenceArg(1);
+	float values[ROXY_SEQUENCE_MAX_CHANNELS] = { 0 };
+	int count = getValueArgs(2, values);
+	pd->lua->pushInt(roxy_sequence_fromValues(sequence, values, count));
+	return 1;
+}
+
+// sequence:toValues(duration, ease, value1, value2, ...) -> easingCount
+// Missing values are 0
+static int sequence_toValues(lua_State* L) {
+	(void)L;
+	
+	RoxySequence* sequence = getSequenceArg(1);
+	float duration = pd->lua->getArgFloat(2);
+	
+	RoxyCurve* curve;
+	LuaUDObject* curveObject;
+	int ease = getEaseArg(3, &curve, &curveObject);
+	
+	float values[ROXY_SEQUENCE_MAX_CHANNELS] = { 0 };
+	getValueArgs(4, values);
+	pd->lua->pushInt(roxy_sequence_toValues(sequence, values, duration, ease, curve, curveObject));
+	return 1;
+}
+
+// sequence:setValues(value1, value2, ...) -> easingCount
+static int sequence_setValues(lua_State* L) {
+	(void)L;
+	
+	RoxySequence* sequence = getSequenceArg(1);
+	float values[ROXY_SEQUENCE_MAX_CHANNELS] = { 0 };
+	getValueArgs(2, values);
+	pd->lua->pushInt(roxy_sequence_setValues(sequence, values));
+	return 1;
+}
+
+static int sequence_getChannelCount(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushInt(getSequenceArg(1)->channelCount);
+	return 1;
+}
+
+// sequence:set(value) -> easingCount
+static int sequence_set(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushInt(roxy_sequence_set(getSequenceArg(1), pd->lua->getArgFloat(2)));
+	return 1;
+}
+
+// sequence:again(repeatCount, pingPong) -> easingCount
+static int sequence_again(lua_State* L) {
+	(void)L;
+	
+	RoxySequence* sequence = getSequenceArg(1);
+	int repeatCount = pd->lua->argIsNil(2) ? 1 : pd->lua->getArgInt(2);
+	pd->lua->pushInt(roxy_sequence_again(sequence, repeatCount, pd->lua->getArgBool(3)));
+	return 1;
+}
+
+// sequence:sleep(duration) -> easingCount
+static int sequence_sleep(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushInt(roxy_sequence_sleep(getSequenceArg(1), pd->lua->getArgFloat(2)));
+	return 1;
+}
+
+static int sequence_reverse(lua_State* L) {
+	(void)L;
+	
+	roxy_sequence_reverse(getSequenceArg(1));
+	return 0;
+}
+
+// sequence:setLoopType(loopType), where loopType is a RoxySequenceLoopType
+static int sequence_setLoopType(lua_State* L) {
+	(void)L;
+	
+	RoxySequence* sequence = getSequenceArg(1);
+	sequence->loopType = getLoopTypeArg(2);
+	sequence->hasCachedResult = 0;
+	syncPool(sequence);
+	return 0;
+}
+
+// sequence:addCallback(timestamp) -> callbackIndex
+static int sequence_addCallback(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushInt(roxy_sequence_addCallback(getSequenceArg(1), pd->lua->getArgFloat(2)));
+	return 1;
+}
+
+static int sequence_setPacing(lua_State* L) {
+	(void)L;
+	
+	roxy_sequence_setPacing(getSequenceArg(1), pd->lua->getArgFloat(2));
+	return 0;
+}
+
+// sequence:setPreviousUpdateTime(currentTimeMilliseconds)
+static int sequence_setPreviousUpdateTime(lua_State* L) {
+	(void)L;
+	
+	roxy_sequence_setPreviousUpdateTime(getSequenceArg(1), (unsigned int)pd->lua->getArgInt(2));
+	return 0;
+}
+
+// sequence:update(deltaTime) -> callbackIndex, ...
+// Returns the 1-based indices of the callbacks fired during this update
+// Pushes up to ROXY_SEQUENCE_MAX_EVENTS_PER_CALL callback indices from a manual update, preceded by whether more remain
+static int pushSequenceEvents(RoxySequence* sequence) {
+	RoxySequenceEvents* events = &sequence->events;
+	int remaining = (events->count - events->readIndex) / 2;
+	int count = remaining < ROXY_SEQUENCE_MAX_EVENTS_PER_CALL ? remaining : ROXY_SEQUENCE_MAX_EVENTS_PER_CALL;
+	
+	pd->lua->pushBool(remaining > count);
+	for (int i = 0; i < count; ++i) {
+		pd->lua->pushInt(events->values[events->readIndex + 1]);
+		events->readIndex += 2;
+	}
+	return 1 + count;
+}
+
+// sequence:update(deltaTime) -> hasMoreEvents, index, index, ...; the rest come from sequence:popEvents()
+static int sequence_update(lua_State* L) {
+	(void)L;
+	
+	RoxySequence* sequence = getSequenceArg(1);
+	RoxySequenceEvents* events = &sequence->events;
+	
+	// Events not yet returned, e.g. when a callback updates its own sequence, stay queued ahead of the new ones
+	if (events->readIndex >= events->count) {
+		events->count = 0;
+		events->readIndex = 0;
+	}
+	roxy_sequence_update(sequence, pd->lua->getArgFloat(2), events);
+	return pushSequenceEvents(sequence);
+}
+
+static int sequence_popEvents(lua_State* L) {
+	(void)L;
+	
+	return pushSequenceEvents(getSequenceArg(1));
+}
+
+static int sequence_start(lua_State* L) {
+	(void)L;
+	
+	roxy_sequence_start(getSequenceArg(1));
+	return 0;
+}
+
+static int sequence_stop(lua_State* L) {
+	(void)L;
+	
+	roxy_sequence_stop(getSequenceArg(1));
+	return 0;
+}
+
+static int sequence_isRunning(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushBool(roxy_sequence_isRunning(getSequenceArg(1)));
+	return 1;
+}
+
+static int sequence_getId(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushInt(getSequenceArg(1)->id);
+	return 1;
+}
+
+static int sequence_getTime(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushFloat(roxy_sequence_getTime(getSequenceArg(1)));
+	return 1;
+}
+
+static int sequence_setTime(lua_State* L) {
+	(void)L;
+	
+	roxy_sequence_setTime(getSequenceArg(1), pd->lua->getArgFloat(2));
+	return 0;
+}
+
+static int sequence_getDuration(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushFloat(getSequenceArg(1)->duration);
+	return 1;
+}
+
+static int sequence_isDone(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushBool(roxy_sequence_isDone(getSequenceArg(1)));
+	return 1;
+}
+
+// sequence:getClampedTime([time]) -> clampedTime, isForward
+static int sequence_getClampedTime(lua_State* L) {
+	(void)L;
+	
+	RoxySequence* sequence = getSequenceArg(1);
+	float time = pd->lua->argIsNil(2) ? roxy_sequence_getTime(sequence) : pd->lua->getArgFloat(2);
+	int isForward;
+	float clampedTime = roxy_sequence_clampTime(time, sequence->duration, sequence->loopType, &isForward);
+	
+	pd->lua->pushFloat(clampedTime);
+	pd->lua->pushBool(isForward);
+	return 2;
+}
+
+// sequence:getClampedTimes(startTime, endTime) -> clampedStart, clampedEnd, isForward
+static int sequence_getClampedTimes(lua_State* L) {
+	(void)L;
+	
+	RoxySequence* sequence = getSequenceArg(1);
+	int isForward;
+	float clampedStart = roxy_sequence_clampTime(pd->lua->getArgFloat(2), sequence->duration, sequence->loopType, &isForward);
+	float clampedEnd = roxy_sequence_clampTime(pd->lua->getArgFloat(3), sequence->duration, sequence->loopType, NULL);
+	
+	pd->lua->pushFloat(clampedStart);
+	pd->lua->pushFloat(clampedEnd);
+	pd->lua->pushBool(isForward);
+	return 3;
+}
+
+// sequence:getValue([defaultValue], [time]) -> value
+// For Lua-eased segments, returns nil followed by the segment index and its (t, b, c, d) arguments,
+// so RoxySequence.lua can call the Lua easing function itself.
+static int sequence_getValue(lua_State* L) {
+	(void)L;
+	
+	RoxySequence* sequence = getSequenceArg(1);
+	float defaultValue = pd->lua->argIsNil(2) ? 0.0f : pd->lua->getArgFloat(2);
+	float time = pd->lua->argIsNil(3) ? roxy_sequence_getTime(sequence) : pd->lua->getArgFloat(3);
+	
+	if (sequence->easingCount == 0) {
+		pd->lua->pushFloat(0.0f);
+		return 1;
+	}
+	
+	float clampedTime = roxy_sequence_clampTime(time, sequence->duration, sequence->loopType, NULL);
+	if (sequence->hasCachedResult && sequence->cachedTimestamp == clampedTime) {
+		pd->lua->pushFloat(sequence->cachedResult);  // Return cached result if available
+		return 1;
+	}
+	
+	if (sequence->bakedSampleCount > 0) {
+		float values[ROXY_SEQUENCE_MAX_CHANNELS];
+		roxy_sequence_evaluateBaked(sequence, clampedTime, values);
+		pd->lua->pushFloat(values[0]);
+		return 1;
+	}
+	
+	const RoxySequenceEasing* easing = roxy_sequence_getEasingByTime(sequence, clampedTime);
+	if (easing->ease == ROXY_SEQUENCE_EASE_LUA) {
+		pd->lua->pushNil();
+		pd->lua->pushInt((int)(easing - sequence->easings) + 1);
+		pd->lua->pushFloat(clampedTime - easing->timestamp);
+		pd->lua->pushFloat(easing->from);
+		pd->lua->pushFloat(easing->to - easing->from);
+		pd->lua->pushFloat(easing->duration);
+		return 6;
+	}
+	
+	float result = roxy_sequence_evaluateEasing(easing, clampedTime);
+	if (result != result) {
+		result = defaultValue;  // Fallback to default if result is NaN
+	}
+	
+	sequence->cachedTimestamp = clampedTime;
+	sequence->cachedResult = result;
+	sequence->hasCachedResult = 1;
+	
+	pd->lua->pushFloat(result);
+	return 1;
+}
+
+// sequence:getValues([time]) -> value1, value2, ...
+// For Lua-eased segments, returns nil, the segment index, t and d, followed by a (from, to) pair per channel.
+static int sequence_getValues(lua_State* L) {
+	(void)L;
+	
+	RoxySequence* sequence = getSequenceArg(1);
+	float time = pd->lua->argIsNil(2) ? roxy_sequence_getTime(sequence) : pd->lua->getArgFloat(2);
+	int channelCount = sequence->channelCount;
+	
+	if (sequence->easingCount == 0) {
+		for (int i = 0; i < channelCount; ++i) {
+			pd->lua->pushFloat(0.0f);
+		}
+		return channelCount;
+	}
+	
+	float clampedTime = roxy_sequence_clampTime(time, sequence->duration, sequence->loopType, NULL);
+	float values[ROXY_SEQUENCE_MAX_CHANNELS];
+	if (sequence->bakedSampleCount > 0) {
+		roxy_sequence_evaluateBaked(sequence, clampedTime, values);
+		for (int i = 0; i < channelCount; ++i) {
+			pd->lua->pushFloat(values[i]);
+		}
+		return channelCount;
+	}
+	if (roxy_sequence_evaluateValues(sequence, clampedTime, values) > 0) {
+		for (int i = 0; i < channelCount; ++i) {
+			pd->lua->pushFloat(values[i]);
+		}
+		return channelCount;
+	}
+	
+	const RoxySequenceEasing* easing = roxy_sequence_getEasingByTime(sequence, clampedTime);
+	int index = (int)(easing - sequence->easings);
+	pd->lua->pushNil();
+	pd->lua->pushInt(index + 1);
+	pd->lua->pushFloat(clampedTime - easing->timestamp);
+	pd->lua->pushFloat(easing->duration);
+	pd->lua->pushFloat(easing->from);
+	pd->lua->pushFloat(easing->to);
+	
+	int extraCount = channelCount - 1;
+	const float* data = extraCount > 0 ? channelData(sequence, index) : NULL;
+	for (int i = 0; i < extraCount; ++i) {
+		pd->lua->pushFloat(data[i]);
+		pd->lua->pushFloat(data[extraCount + i]);
+	}
+	return 4 + channelCount * 2;
+}
+
+// sequence:bake(sampleRate) -> success
+static int sequence_bake(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushBool(roxy_sequence_bake(getSequenceArg(1), pd->lua->getArgFloat(2)));
+	return 1;
+}
+
+// sequence:beginBake(sampleCount) -> success
+static int sequence_beginBake(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushBool(roxy_sequence_beginBake(getSequenceArg(1), pd->lua->getArgInt(2)));
+	return 1;
+}
+
+// sequence:setBakedSample(index, value1, value2, ...), with a 1-based index
+static int sequence_setBakedSample(lua_State* L) {
+	(void)L;
+	
+	RoxySequence* sequence = getSequenceArg(1);
+	float values[ROXY_SEQUENCE_MAX_CHANNELS] = { 0 };
+	getValueArgs(3, values);
+	roxy_sequence_setBakedSample(sequence, pd->lua->getArgInt(2) - 1, values);
+	return 0;
+}
+
+static int sequence_clearBake(lua_State* L) {
+	(void)L;
+	
+	roxy_sequence_clearBake(getSequenceArg(1));
+	return 0;
+}
+
+static int sequence_isBaked(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushBool(roxy_sequence_isBaked(getSequenceArg(1)));
+	return 1;
+}
+
+// sequence:saveBaked(path) -> success
+static int sequence_saveBaked(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushBool(roxy_sequence_saveBaked(getSequenceArg(1), pd->lua->getArgString(2)));
+	return 1;
+}
+
+// sequence:loadBaked(path) -> easingCount, or 0 on failure
+static int sequence_loadBaked(lua_State* L) {
+	(void)L;
+	
+	RoxySequence* sequence = getSequenceArg(1);
+	int success = roxy_sequence_loadBaked(sequence, pd->lua->getArgString(2));
+	pd->lua->pushInt(success ? sequence->easingCount : 0);
+	return 1;
+}
+
+static const lua_reg sequenceClass[] = {
+	{ "__gc", sequence_gc },
+	{ "clear", sequence_clear },
+	{ "reserve", sequence_reserve },
+	{ "from", sequence_from },
+	{ "to", sequence_to },
+	{ "fromValues", sequence_fromValues },
+	{ "toValues", sequence_toValues },
+	{ "setValues", sequence_setValues },
+	{ "getChannelCount", sequence_getChannelCount },
+	{ "set", sequence_set },
+	{ "again", sequence_again },
+	{ "sleep", sequence_sleep },
+	{ "reverse", sequence_reverse },
+	{ "setLoopType", sequence_setLoopType },
+	{ "addCallback", sequence_addCallback },
+	{ "setPacing", sequence_setPacing },
+	{ "setPreviousUpdateTime", sequence_setPreviousUpdateTime },
+	{ "update", sequence_update },
+	{ "popEvents", sequence_popEvents },
+	{ "start", sequence_start },
+	{ "stop", sequence_stop },
+	{ "isRunning", sequence_isRunning },
+	{ "getId", sequence_getId },
+	{ "getTime", sequence_getTime },
+	{ "setTime", sequence_setTime },
+	{ "getDuration", sequence_getDuration },
+	{ "isDone", sequence_isDone },
+	{ "getClampedTime", sequence_getClampedTime },
+	{ "getClampedTimes", sequence_getClampedTimes },
+	{ "getValue", sequence_getValue },
+	{ "getValues", sequence_getValues },
+	{ "bake", sequence_bake },
+	{ "beginBake", sequence_beginBake },
+	{ "setBakedSample", sequence_setBakedSample },
+	{ "clearBake", sequence_clearBake },
+	{ "isBaked", sequence_isBaked },
+	{ "saveBaked", sequence_saveBaked },
+	{ "loadBaked", sequence_loadBaked },
+	{ NULL, NULL }
+};
+
+// Loop mode constants, exposed as roxy.sequence.LOOP_NONE, LOOP and PINGPONG
+static const lua_reg noFunctions[] = { { NULL, NULL } };
+static const lua_val loopModes[] = {
+	{ "LOOP_NONE", kInt, { .intval = kRoxySequenceLoopNone } },
+	{ "LOOP", kInt, { .intval = kRoxySequenceLoop } },
+	{ "PINGPONG", kInt, { .intval = kRoxySequencePingPong } },
+	{ NULL, kInt, { .intval = 0 } }
+};
+
+int roxy_sequence_registerClass(const char** outErr) {
+	// Registered first, so the roxy.sequence table exists before the native class and functions are added to it
+	if (!pd->lua->registerClass("roxy.sequence", noFunctions, loopModes, 1, outErr)) {
+		return 0;
+	}
+	return pd->lua->registerClass(ROXY_SEQUENCE_CLASS, sequenceClass, NULL, 0, outErr);
+}
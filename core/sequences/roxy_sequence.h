@@ -7,12 +7,246 @@
 #define ROXY_SEQUENCE_H
 
 #include "pd_api.h"
+#include "../../utilities/roxy_ease.h"
+#include "../../utilities/roxy_curve.h"
+
+// Lua class name for native sequence userdata
+#define ROXY_SEQUENCE_CLASS "roxy.sequence.native"
+
+// Initial number of easing segments allocated for a new sequence
+#define ROXY_SEQUENCE_INITIAL_CAPACITY 8
+
+// Maximum number of channels (values per keyframe) in a multi-channel sequence
+#define ROXY_SEQUENCE_MAX_CHANNELS 8
+
+// Largest sample count accepted when baking or loading a baked track
+#define ROXY_SEQUENCE_MAX_BAKED_SAMPLES 65536
+
+// Baked track files start with this identifier, followed by a format version
+#define ROXY_SEQUENCE_BAKED_MAGIC "RXBK"
+#define ROXY_SEQUENCE_BAKED_VERSION 1
+
+// Initial number of running sequences the sequence pool has room for
+#define ROXY_SEQUENCE_POOL_INITIAL_CAPACITY 32
+
+// Maximum number of (id, event) pairs returned to Lua per call, keeping the Lua stack small.
+// Remaining events are fetched with roxy.sequence.popEvents.
+#define ROXY_SEQUENCE_MAX_EVENTS_PER_CALL 8
+
+// Event index reported when a pooled sequence finishes; callback events use their 1-based callback index
+#define ROXY_SEQUENCE_EVENT_FINISHED 0
+
+// Special easing identifiers for segments that are not one of the built-in easings
+#define ROXY_SEQUENCE_EASE_LUA -1	// Eased by a Lua function; evaluated by RoxySequence.lua
+#define ROXY_SEQUENCE_EASE_CURVE -2	// Eased by a roxy.curve custom easing
+
+typedef enum {
+	kRoxySequenceLoopNone,
+	kRoxySequenceLoop,
+	kRoxySequencePingPong
+} RoxySequenceLoopType;
+
+// Growable list of (id, event) pairs produced by sequence updates
+typedef struct {
+	int* values;	// Two ints per event: the sequence id, then the event
+	int count;		// Number of ints used
+	int capacity;
+	int readIndex;	// Next int to return to Lua
+} RoxySequenceEvents;
+
+// One easing segment of a sequence, packed for evaluation in C
+typedef struct {
+	float timestamp;	// Start time of the easing
+	float from;			// Initial value
+	float to;			// Final value
+	float duration;		// Duration of the easing
+	int ease;			// RoxyEaseType, or one of the ROXY_SEQUENCE_EASE_* identifiers
+	RoxyCurve* curve;	// Custom curve when ease is ROXY_SEQUENCE_EASE_CURVE
+	LuaUDObject* curveObject;  // Retained Lua object owning the curve
+} RoxySequenceEasing;
+
+typedef struct {
+	int id;				// Unique identifier, used to match pool events to their Lua sequence
+	int poolIndex;		// Index in the sequence pool while running, or -1
+	
+	RoxySequenceEasing* easings;
+	int easingCount;
+	int easingCapacity;
+	
+	// Multi-channel sequences keep channel 0 in the easings, and channels 1 and up here.
+	// Each easing has (channelCount - 1) from values followed by (channelCount - 1) to values.
+	int channelCount;
+	float* channelValues;
+	int channelValuesCapacity;	// In floats
+	
+	// Callback timeline, sorted by timestamp. The cursor is the next callback to fire forward,
+	// or one past the next callback to fire while a ping-pong runs backward.
+	float* callbackTimes;	// Callback timestamps, in ascending order
+	int* callbackIndices;	// 1-based index each callback was added with, parallel to callbackTimes
+	int callbackCount;
+	int callbackCapacity;
+	int callbackCursor;		// -1 when the cursor must be found again from the current time
+	float callbackSyncTime;	// Time the cursor was left at; any other time resynchronizes it
+	
+	float time;			// Current time in the sequence's progression; owned by the pool while running
+	float duration;		// Total duration of the sequence
+	float pacing;		// Multiplier applied to the delta time
+	RoxySequenceLoopType loopType;
+	
+	int hasPreviousUpdateTime;			// Whether delta time is measured from the system clock
+	unsigned int previousUpdateTime;	// Milliseconds of the last update, when hasPreviousUpdateTime is set
+	
+	// Baked track: channelCount interleaved values per sample, evenly spaced from 0 to duration.
+	// When present, values are read from it with a lerp instead of evaluating the easings.
+	float* bakedSamples;
+	int bakedSampleCount;
+	int bakedSampleCapacity;	// In floats
+	float bakedScale;			// Samples per second, so a clamped time maps to a sample position
+	
+	int previousEasingIndex;  // Index of the last evaluated easing, checked first on the next lookup
+	int hasCachedResult;
+	float cachedTimestamp;
+	float cachedResult;
+	
+	RoxySequenceEvents events;  // Callbacks fired by manual updates, returned to Lua a page at a time
+} RoxySequence;
 
 void roxy_sequence_setPlaydateAPI(PlaydateAPI* playdate);
 
+// Clamps or wraps a time according to the loop type; isForward is set to 0 while a ping-pong runs backward
+float roxy_sequence_clampTime(float time, float duration, RoxySequenceLoopType loopType, int* outIsForward);
+
+// ! Native Sequences
+RoxySequence* roxy_sequence_new(void);
+void roxy_sequence_free(RoxySequence* sequence);
+void roxy_sequence_clear(RoxySequence* sequence);
+
+// Grows the easing storage to hold at least easingCapacity easings without reallocating
+int roxy_sequence_reserve(RoxySequence* sequence, int easingCapacity);
+
+// Builders, mirroring RoxySequence.lua. Each returns the new easing count, or 0 if the sequence has no easings.
+int roxy_sequence_from(RoxySequence* sequence, float from);
+int roxy_sequence_to(RoxySequence* sequence, float to, float duration, int ease, RoxyCurve* curve, LuaUDObject* curveObject);
+int roxy_sequence_set(RoxySequence* sequence, float value);
+int roxy_sequence_again(RoxySequence* sequence, int repeatCount, int pingPong);
+int roxy_sequence_sleep(RoxySequence* sequence, float duration);
+void roxy_sequence_reverse(RoxySequence* sequence);
+
+// Multi-channel builders; values holds one value per channel. fromValues sets the channel count.
+// Scalar builders used on a multi-channel sequence hold the other channels at their last value.
+int roxy_sequence_fromValues(RoxySequence* sequence, const float* values, int channelCount);
+int roxy_sequence_toValues(RoxySequence* sequence, const float* values, float duration, int ease, RoxyCurve* curve, LuaUDObject* curveObject);
+int roxy_sequence_setValues(RoxySequence* sequence, const float* values);
+
+// Registers a callback timestamp, keeping the timeline sorted, and returns its 1-based index
+int roxy_sequence_addCallback(RoxySequence* sequence, float timestamp);
+
+// Sets the pacing multiplier applied to delta time
+void roxy_sequence_setPacing(RoxySequence* sequence, float pacing);
+
+// Measures delta time from the system clock, starting at the given time in milliseconds
+void roxy_sequence_setPreviousUpdateTime(RoxySequence* sequence, unsigned int currentTime);
+
+float roxy_sequence_getTime(const RoxySequence* sequence);
+void roxy_sequence_setTime(RoxySequence* sequence, float time);
+
+// Advances the sequence's time, appending an (id, callbackIndex) pair to outEvents for each fired callback.
+// outEvents may be NULL when callbacks are not needed.
+void roxy_sequence_update(RoxySequence* sequence, float deltaTime, RoxySequenceEvents* outEvents);
+
+// Returns whether a non-looping sequence has reached its end
+int roxy_sequence_isDone(const RoxySequence* sequence);
+
+// ! Sequence Pool
+// Running sequences are advanced together by roxy_sequence_updateAll, which walks the pool's
+// time, duration, pacing and loop arrays in one loop and swap-removes finished sequences.
+
+// Adds the sequence to the pool; does nothing if it is empty or already running
+void roxy_sequence_start(RoxySequence* sequence);
+
+// Removes the sequence from the pool, keeping its current time
+void roxy_sequence_stop(RoxySequence* sequence);
+
+int roxy_sequence_isRunning(const RoxySequence* sequence);
+
+// Removes every sequence from the pool
+void roxy_sequence_stopAll(void);
+
+// Advances every running sequence. Fired callbacks and finished sequences are queued as
+// (id, event) pairs, see ROXY_SEQUENCE_EVENT_FINISHED.
+void roxy_sequence_updateAll(float deltaTime);
+
+int roxy_sequence_getRunningCount(void);
+
+// Grows the pool to hold at least capacity running sequences without reallocating
+int roxy_sequence_reservePool(int capacity);
+
+// Returns the easing active at a clamped time, or NULL for an empty sequence
+const RoxySequenceEasing* roxy_sequence_getEasingByTime(RoxySequence* sequence, float clampedTime);
+
+// Evaluates a built-in or curve easing segment; Lua-eased segments return their start value
+float roxy_sequence_evaluateEasing(const RoxySequenceEasing* easing, float clampedTime);
+
+// Evaluates every channel at a clamped time into outValues, which has room for channelCount values.
+// Returns the channel count, or 0 if the active easing is Lua-eased or the sequence is empty.
+int roxy_sequence_evaluateValues(RoxySequence* sequence, float clampedTime, float* outValues);
+
+// ! Baked Tracks
+
+// Samples the sequence at sampleRate samples per second into a baked track.
+// Returns 0 if the sequence is empty or has Lua-eased segments, which RoxySequence.lua samples itself.
+int roxy_sequence_bake(RoxySequence* sequence, float sampleRate);
+
+// Allocates an empty baked track of sampleCount samples, to be filled with roxy_sequence_setBakedSample
+int roxy_sequence_beginBake(RoxySequence* sequence, int sampleCount);
+
+// Sets the channel values of one baked sample
+void roxy_sequence_setBakedSample(RoxySequence* sequence, int index, const float* values);
+
+// Drops the baked track, going back to evaluating the easings; the memory is kept for the next bake
+void roxy_sequence_clearBake(RoxySequence* sequence);
+
+int roxy_sequence_isBaked(const RoxySequence* sequence);
+
+// Reads the baked value of every channel at a clamped time into outValues
+void roxy_sequence_evaluateBaked(const RoxySequence* sequence, float clampedTime, float* outValues);
+
+// Writes the baked track to a binary file. Returns 0 on failure.
+int roxy_sequence_saveBaked(const RoxySequence* sequence, const char* path);
+
+// Replaces the sequence with a baked track read from a binary file, checking the Data folder first.
+// The sequence gets one linear easing spanning the track, so it can be started like any other sequence.
+// Returns 0 on failure.
+int roxy_sequence_loadBaked(RoxySequence* sequence, const char* path);
+
 // Lua binding for retrieving clamped time in a sequence.
-// Runs the implementation in C (see roxy_sequence.c) for performance.
-// See RoxySequence.lua for the rest of the sequence logic.
+// roxy.sequence.getClampedTime(time, duration, [loopMode]) -> clampedTime, isForward
+// The loop mode is one of roxy.sequence.LOOP_NONE, LOOP or PINGPONG.
 int roxy_sequence_getClampedTime_l(lua_State* L);
 
+// Lua binding for clamping two times of the same sequence in one call.
+// roxy.sequence.getClampedTimes(startTime, endTime, duration, [loopMode]) -> clampedStart, clampedEnd, isForward
+int roxy_sequence_getClampedTimes_l(lua_State* L);
+
+// Creates a native sequence object (roxy.sequence.new)
+int roxy_sequence_new_l(lua_State* L);
+
+// roxy.sequence.updateAll(deltaTime) -> hasMoreEvents, id, event, id, event, ...
+int roxy_sequence_updateAll_l(lua_State* L);
+
+// roxy.sequence.popEvents() -> hasMoreEvents, id, event, ...; returns events left over from updateAll
+int roxy_sequence_popEvents_l(lua_State* L);
+
+// roxy.sequence.stopAll()
+int roxy_sequence_stopAll_l(lua_State* L);
+
+// roxy.sequence.getRunningCount() -> count
+int roxy_sequence_getRunningCount_l(lua_State* L);
+
+// roxy.sequence.reservePool(capacity) -> success
+int roxy_sequence_reservePool_l(lua_State* L);
+
+// Registers the loop mode constants and the native sequence userdata class with Lua
+int roxy_sequence_registerClass(const char** outErr);
+
 #endif /* ROXY_SEQUENCE_H */
@@ -24,9 +24,7 @@ local defaultProperties = {
 	ease = Ease.outQuad,
 	
 	-- Graphics properties
-	dither = 
-		transitionManager:getDither("bayer8x8") or  
-		Graphics.image.kDitherTypebayer8x8  -- Fallback dither type
+	ditherId = roxy.graphics.DITHER_BAYER8X8  -- Blended natively; pass an SDK `dither` type to use `drawFaded` instead
 }
 
 function transition:init(duration, holdTime, properties)
@@ -26,12 +26,8 @@ local defaultProperties = {
 	ease = Ease.outInQuad,
 	
 	-- Graphics properties
-	dither = 
-		transitionManager:getDither("bayer8x8") or 
-		Graphics.image.kDitherTypebayer8x8,  -- Fallback dither type
-	panelImage = 
-		transitionManager:getImage("panelImageWhite") or 
-		Graphics.image.new(displayWidth, displayHeight, Graphics.kColorWhite)  -- Fallback white panel
+	ditherId = roxy.graphics.DITHER_BAYER8X8,  -- Filled from cached dither levels; pass an SDK `dither` type to use `drawFaded` instead
+	panelImageType = "panelImageWhite"  -- Shared white panel from the transition manager
 }
 
 function transition:init(duration, holdTime, properties)
@@ -44,10 +40,4 @@ function transition:init(duration, holdTime, properties)
 	local mergedProperties = roxy.table.mergeImmutable(defaultProperties, properties)
 
 	transition.super.init(self, properties.duration, properties.holdTime, mergedProperties)
-end
-
-function transition:cleanup()
-	transition.super.cleanup(self)
-	-- Recycle the panel image back to the transition manager for reuse
-	transitionManager:recycleImage("panelImageWhite", self.panelImage)
 end
\ No newline at end of file
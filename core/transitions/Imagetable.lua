@@ -19,13 +19,8 @@ local defaultProperties = {
 	duration = configurationManager:getConfig().defaultTransitionDuration or 1.5,
 	holdTime = 0.0,  -- No hold time for this transition
 	
-	-- Image table properties
-	imagetableEnter = 
-		transitionManager:getImagetable("imagetableEnter") or 
-		Graphics.imagetable.new("libraries/roxy/assets/images/SLOTHUniversalLeaderEnter"),
-	imagetableExit = 
-		transitionManager:getImagetable("imagetableExit") or 
-		Graphics.imagetable.new("libraries/roxy/assets/images/SLOTHUniversalLeaderExit"),
+	-- Image table properties: without imagetableEnter and imagetableExit, 
+	-- the shared imagetables are acquired from the transition manager for each transition
 	
 	-- Transformation properties
 	reverse = false,
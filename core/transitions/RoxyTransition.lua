@@ -8,6 +8,7 @@ local pd <const> = playdate
 local Object <const> = pd.object
 local Graphics <const> = pd.graphics
 local Ease <const> = roxy.easingFunctions
+local RoxyGraphics <const> = roxy.graphics
 
 local displayWidth, displayHeight, displayCenterX, displayCenterY = roxy.graphics.getDisplaySize()
 
@@ -39,21 +40,28 @@ function RoxyTransition:init(duration, holdTime, properties)
 	self.durationExit = properties.durationExit or self.durationEnter
 	
 	-- Screenshot capturing properties
-	self.captureScreenshotsDuringTransition = properties.captureScreenshotsDuringTransition or false  -- Whether to capture screenshots during the transition
-	self.newSceneScreenshot = nil  -- Placeholder for the new scene screenshot
+	self.captureScreenshotsDuringTransition = properties.captureScreenshotsDuringTransition or false  -- Whether to capture the new scene each frame; it is drawn on screen, then copied
+	self.newSceneScreenshot = nil  -- The new scene, captured each frame into a surface shared by all transitions
 	
 	-- State properties
 	self.midpointReached = false
 	self.holdTimeElapsed = false
 	
+	-- Asset loading properties
+	self.assetLoader = nil  -- Loads the new scene's asset manifest, if it has one
+	self.isWaitingForAssets = false  -- Whether the transition is held at its midpoint for the assets
+	self.pendingMidpoint = nil
+	
 	-- Sequence properties
 	self.sequence = nil
 end
 
 -- ! Execute the Transition
 -- Executes the transition by managing the lifecycle of the current and new scenes.
-function RoxyTransition:execute(newScene, currentScene)
+-- With an asset loader, `newScene` is nil and the scene is created from `newSceneClass` at the midpoint.
+function RoxyTransition:execute(newScene, currentScene, assetLoader, newSceneClass)
 	self.midpointReached = false  -- Ensure the transition always starts with midpointReached set to false
+	self.assetLoader = assetLoader
 	
 	local onStart = function()
 		inputManager:clearHandler()  -- Reset input handler
@@ -63,7 +71,19 @@ function RoxyTransition:execute(newScene, currentScene)
 		end
 	end
 
-	local onMidpoint = function()
+	local onMidpoint
+	onMidpoint = function()
+		if self.midpointReached then return end  -- Fires again when a held sequence resumes at the midpoint
+		
+		-- Hold the transition until the new scene's assets are loaded
+		if assetLoader and not assetLoader:isReady() then
+			if self.sequence then
+				self:waitForAssets(onMidpoint)
+				return
+			end
+			assetLoader:finish()  -- Nothing to animate while loading, so load the rest now
+		end
+		
 		self.midpointReached = true
 		
 		if currentScene then
@@ -71,6 +91,17 @@ function RoxyTransition:execute(newScene, currentScene)
 			currentScene = nil
 		end
 		
+		if not newScene then
+			newScene = newSceneClass()
+			if not newScene then
+				error("ERROR: newScene is not properly instantiated or missing methods.")
+			end
+		end
+		if assetLoader then
+			newScene.assetLoader = assetLoader  -- The scene holds its assets until its cleanup
+			self.assetLoader = nil
+		end
+		
 		sceneManager:setCurrentScene(newScene)  -- Set the new scene
 		
 		newScene:resetDrawOffset()
@@ -93,6 +124,38 @@ function RoxyTransition:execute(newScene, currentScene)
 	self:setUpSequence(onStart, onMidpoint, onHoldTimeElapsed, onComplete)
 end
 
+-- ! Wait for Assets
+-- Pauses the sequence at the midpoint until the asset loader is ready
+function RoxyTransition:waitForAssets(onMidpoint)
+	self.isWaitingForAssets = true
+	self.pendingMidpoint = onMidpoint
+	self.sequence:pause()
+end
+
+-- Called each frame while waiting. Mix transitions reach their midpoint before their sequence starts,
+-- so the sequence is paused here too.
+function RoxyTransition:updateWaitingForAssets()
+	local sequence = self.sequence
+	if not self.assetLoader or self.assetLoader:isReady() then
+		self.isWaitingForAssets = false
+		local onMidpoint = self.pendingMidpoint
+		self.pendingMidpoint = nil
+		onMidpoint()
+		
+		-- Rewind to the midpoint, so callbacks passed in the frame it was paused fire again
+		for i = 1, #sequence.callbacks do
+			local callbackObject = sequence.callbacks[i]
+			if callbackObject.callbackFunction == onMidpoint then
+				sequence.native:setTime(callbackObject.timestamp)
+				break
+			end
+		end
+		sequence:start()
+	elseif sequence:getIsRunning() then
+		sequence:pause()
+	end
+end
+
 -- Placeholder methods to be implemented in derived classes
 function RoxyTransition:setUpSequence(onStart, onMidpoint, onHoldTimeElapsed, onComplete)
 	-- Implement sequence setup logic in derived classes
@@ -157,10 +220,22 @@ function RoxyCoverTransition:init(duration, holdTime, properties)
 		properties.dither or 
 		transitionManager:getDither("bayer8x8") or 
 		Graphics.image.kDitherTypebayer8x8  -- Fallback dither type
-	self.panelImage = 
-		properties.panelImage or 
-		transitionManager:getImage("panelImage") or 
-		Graphics.image.new(displayWidth, displayHeight, Graphics.kColorBlack)  -- Fallback to a black panel
+	self.panelImageType = properties.panelImageType or "panelImageBlack"  -- Shared panel used when no panelImage is given
+	self.panelImage = properties.panelImage
+	
+	-- A shared solid panel is filled with the transition manager's cached dither level patterns, in C
+	-- (roxy_graphics.c), unless an SDK dither type or another draw mode is given
+	self.ditherId = properties.ditherId or RoxyGraphics.DITHER_BAYER8X8
+	self.useFadePanel = 
+		not self.panelImage and 
+		properties.dither == nil and 
+		self.drawMode == Graphics.kDrawModeCopy and 
+		transitionManager:hasFadePanel(self.panelImageType)
+	
+	if not self.panelImage and not self.useFadePanel then
+		self.panelImage = transitionManager:getImage(self.panelImageType)
+		self.ownsPanelImage = true  -- Released in cleanup
+	end
 	
 	-- Sequence properties
 	self.sequenceStartValue = properties.sequenceStartValue or 0
@@ -189,12 +264,20 @@ function RoxyCoverTransition:setUpSequence(onStart, onMidpoint, onHoldTimeElapse
 end
 
 function RoxyCoverTransition:draw()
-	-- Draw the panel image with fading effect
-	self.panelImage:drawFaded(self.x, self.y, self.sequence:getValue(), self.dither)
+	if self.useFadePanel then
+		transitionManager:drawFadePanel(self.panelImageType, self.x, self.y, self.sequence:getValue(), self.ditherId)
+	else
+		-- Draw the panel image with fading effect
+		self.panelImage:drawFaded(self.x, self.y, self.sequence:getValue(), self.dither)
+	end
 end
 
 function RoxyCoverTransition:cleanup()
 	transitionManager:recycleDither("bayer8x8", self.dither)  -- Recycle the dither pattern
+	if self.ownsPanelImage then
+		transitionManager:recycleImage(self.panelImageType, self.panelImage)  -- Release the shared panel image
+		self.ownsPanelImage = false
+	end
 	transitionManager:recycleSequence(self.sequence)  -- Recycle the sequence
 	self.sequence = nil  -- Remove the transition sequencer
 end
@@ -221,14 +304,16 @@ function RoxyImagetableTransition:init(duration, holdTime, properties)
 	
 	-- Image table properties
 	self.imagetable = properties.imagetable or nil  -- Optional imagetable for the entire transition
-	self.imagetableEnter =  -- Imagetable for entering the scene
-		properties.imagetableEnter or 
-		transitionManager:getImagetable("imagetableEnter") or 
-		Graphics.imagetable.new("libraries/roxy/assets/images/SLOTHUniversalLeaderEnter")
-	self.imagetableExit =  -- Imagetable for exiting the scene
-		properties.imagetableExit or 
-		transitionManager:getImagetable("imagetableExit") or 
-		Graphics.imagetable.new("libraries/roxy/assets/images/SLOTHUniversalLeaderExit")
+	self.imagetableEnter = properties.imagetableEnter  -- Imagetable for entering the scene
+	if not self.imagetableEnter then
+		self.imagetableEnter = transitionManager:getImagetable("imagetableEnter")
+		self.ownsImagetableEnter = true  -- Shared imagetables are released in cleanup
+	end
+	self.imagetableExit = properties.imagetableExit  -- Imagetable for exiting the scene
+	if not self.imagetableExit then
+		self.imagetableExit = transitionManager:getImagetable("imagetableExit")
+		self.ownsImagetableExit = true
+	end
 	
 	if not self.imagetable and (not self.imagetableEnter or not self.imagetableExit) then
 		warn("Warning: Either 'imagetable' or both 'imagetableEnter' and 'imagetableExit' must be provided for Imagetable transitions.")
@@ -327,11 +412,15 @@ function RoxyImagetableTransition:getFlipValue(rotate, flipX, flipY)
 end
 
 function RoxyImagetableTransition:cleanup()
-	if self.imagetable then
-		transitionManager:recycleImagetable("imagetable", self.imagetable)  -- Recycle the imagetable if it was used
+	-- Release the shared imagetables; ones passed in properties belong to the caller
+	if self.ownsImagetableEnter then
+		transitionManager:recycleImagetable("imagetableEnter", self.imagetableEnter)
+		self.ownsImagetableEnter = false
+	end
+	if self.ownsImagetableExit then
+		transitionManager:recycleImagetable("imagetableExit", self.imagetableExit)
+		self.ownsImagetableExit = false
 	end
-	transitionManager:recycleImagetable("imagetableEnter", self.imagetableEnter)  -- Recycle the imagetable for entering the scene
-	transitionManager:recycleImagetable("imagetableExit", self.imagetableExit)  -- Recycle the imagetable for exiting the scene
 	transitionManager:recycleSequence(self.sequence)  -- Recycle the sequence
 	self.sequence = nil  -- Remove the transition sequencer
 end
@@ -368,7 +457,12 @@ function RoxyMixTransition:init(duration, holdTime, properties)
 		transitionManager:getDither("bayer8x8") or 
 		Graphics.image.kDitherTypebayer8x8  -- Fallback dither type
 	
-	self.currentSceneScreenshot = Graphics.getDisplayImage()  -- Capture screenshot for transition effect
+	-- Unless an SDK dither type or another draw mode is given, the screenshot is blended straight into
+	-- the frame buffer in C (roxy_graphics.c), with a Bayer 8x8, Bayer 4x4 or blue noise dither
+	self.ditherId = properties.ditherId or RoxyGraphics.DITHER_BAYER8X8
+	self.useNativeDissolve = properties.dither == nil and self.drawMode == Graphics.kDrawModeCopy
+	
+	self.currentSceneScreenshot = transitionManager:captureDisplay()  -- Capture screenshot for transition effect, into a reused surface
 	
 	-- Sequence properties
 	self.sequenceStartValue = properties.sequenceStartValue or 0
@@ -393,13 +487,19 @@ end
 
 function RoxyMixTransition:draw()
 	local currentSceneScreenshot = self.currentSceneScreenshot
-	if currentSceneScreenshot then
-		currentSceneScreenshot:drawFaded(0, 0, 1 - self.sequence:getValue(), self.dither)  -- Draw the screenshot with a fading effect
+	if not currentSceneScreenshot then return end
+	
+	local alpha = 1 - self.sequence:getValue()
+	if self.useNativeDissolve then
+		RoxyGraphics.dissolve(currentSceneScreenshot, alpha, self.ditherId)  -- Marks only the rows that changed
+	else
+		currentSceneScreenshot:drawFaded(0, 0, alpha, self.dither)  -- Draw the screenshot with a fading effect
 	end
 end
 
 function RoxyMixTransition:cleanup()
 	transitionManager:recycleDither("bayer8x8", self.dither)  -- Recycle the dither pattern
+	self.currentSceneScreenshot = nil  -- The capture surface is reused by the next transition
 	transitionManager:recycleSequence(self.sequence)  -- Recycle the sequence
 	self.sequence = nil  -- Remove the transition sequencer
 end
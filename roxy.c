@@ -1,15 +1,19 @@
+#include <string.h>
 #include "pd_api.h"
 #include "utilities/roxy_math.h"
 #include "utilities/roxy_ease.h"
+#include "utilities/roxy_curve.h"
+#include "utilities/roxy_time.h"
+#include "utilities/roxy_profiler.h"
+#include "utilities/roxy_graphics.h"
 #include "core/managers/roxy_input.h"
+#include "core/managers/roxy_crank.h"
+#include "core/managers/roxy_input_recorder.h"
+#include "core/managers/roxy_combo.h"
 #include "core/sequences/roxy_sequence.h"
 
 static PlaydateAPI* pd = NULL;  // Pointer to Playdate API, initialized during Lua event
 
-static float deltaTime = 0.0f;  // Time difference between frames, in seconds
-static uint32_t previousTime = 0;  // Last recorded time in milliseconds
-
-static int updateDeltaTime_l(lua_State* L);  // Lua function to update deltaTime
 
 #ifdef _WINDLL
 __declspec(dllexport)
@@ -22,11 +26,97 @@ int eventHandler(PlaydateAPI* playdate, PDSystemEvent event, uint32_t arg) {
 		
 		const char* error;
 		
-		// ! Register Update Delta Time Function
-		if (!pd->lua->addFunction(updateDeltaTime_l, "roxy.updateDeltaTime", &error)) {
-			pd->system->logToConsole("%s:%i: addFunction failed, %s", __FILE__, __LINE__, error);
+		roxy_time_setPlaydateAPI(pd);
+		
+		// ! Register Time Functions
+		const char* timeFunctions[] = {
+			"roxy.updateDeltaTime",
+			"roxy.getFrameStats",
+			"roxy.time.setDeltaTimeOptions",
+			"roxy.time.setFixedStep",
+			"roxy.time.getFixedStep",
+			"roxy.time.advanceFixedStep",
+			"roxy.time.getAlpha"
+		};
+		int (*timeFuncs[])(lua_State*) = {
+			roxy_time_updateDeltaTime_l,
+			roxy_time_getFrameStats_l,
+			roxy_time_setDeltaTimeOptions_l,
+			roxy_time_setFixedStep_l,
+			roxy_time_getFixedStep_l,
+			roxy_time_advanceFixedStep_l,
+			roxy_time_getAlpha_l
+		};
+		for (int i = 0; i < sizeof(timeFunctions) / sizeof(timeFunctions[0]); ++i) {
+			if (!pd->lua->addFunction(timeFuncs[i], timeFunctions[i], &error)) {
+				pd->system->logToConsole("%s:%i: addFunction failed, %s", __FILE__, __LINE__, error);
+				return -1;
+			}
+		}
+		
+		roxy_profiler_setPlaydateAPI(pd);
+		
+		// ! Register Profiler Functions
+		const char* profilerFunctions[] = {
+			"roxy.profiler.setEnabled",
+			"roxy.profiler.isEnabled",
+			"roxy.profiler.registerZone",
+			"roxy.profiler.beginFrame",
+			"roxy.profiler.phase",
+			"roxy.profiler.beginZone",
+			"roxy.profiler.endZone",
+			"roxy.profiler.endFrame",
+			"roxy.profiler.getStats",
+			"roxy.profiler.drawOverlay",
+			"roxy.profiler.dump",
+			"roxy.profiler.reset"
+		};
+		int (*profilerFuncs[])(lua_State*) = {
+			roxy_profiler_setEnabled_l,
+			roxy_profiler_isEnabled_l,
+			roxy_profiler_registerZone_l,
+			roxy_profiler_beginFrame_l,
+			roxy_profiler_phase_l,
+			roxy_profiler_beginZone_l,
+			roxy_profiler_endZone_l,
+			roxy_profiler_endFrame_l,
+			roxy_profiler_getStats_l,
+			roxy_profiler_drawOverlay_l,
+			roxy_profiler_dump_l,
+			roxy_profiler_reset_l
+		};
+		for (int i = 0; i < sizeof(profilerFunctions) / sizeof(profilerFunctions[0]); ++i) {
+			if (!pd->lua->addFunction(profilerFuncs[i], profilerFunctions[i], &error)) {
+				pd->system->logToConsole("%s:%i: addFunction failed, %s", __FILE__, __LINE__, error);
+				return -1;
+			}
+		}
+		
+		roxy_graphics_setPlaydateAPI(pd);
+		
+		// ! Register Graphics Functions
+		if (!roxy_graphics_registerConstants(&error)) {
+			pd->system->logToConsole("%s:%i: registerClass failed, %s", __FILE__, __LINE__, error);
 			return -1;
 		}
+		const char* graphicsFunctions[] = {
+			"roxy.graphics.captureFrame",
+			"roxy.graphics.captureDisplay",
+			"roxy.graphics.dissolve",
+			"roxy.graphics.fillDithered"
+		};
+		int (*graphicsFuncs[])(lua_State*) = {
+			roxy_graphics_captureFrame_l,
+			roxy_graphics_captureDisplay_l,
+			roxy_graphics_dissolve_l,
+			roxy_graphics_fillDithered_l
+		};
+		for (int i = 0; i < sizeof(graphicsFunctions) / sizeof(graphicsFunctions[0]); ++i) {
+			if (!pd->lua->addFunction(graphicsFuncs[i], graphicsFunctions[i], &error)) {
+				pd->system->logToConsole("%s:%i: addFunction failed, %s", __FILE__, __LINE__, error);
+				return -1;
+			}
+		}
 		
 		roxy_math_setPlaydateAPI(pd);
 		
@@ -103,7 +193,11 @@ int eventHandler(PlaydateAPI* playdate, PDSystemEvent event, uint32_t arg) {
 			"roxy.easingFunctions.outBounce",
 			"roxy.easingFunctions.inBounce",
 			"roxy.easingFunctions.inOutBounce",
-			"roxy.easingFunctions.outInBounce"
+			"roxy.easingFunctions.outInBounce",
+			"roxy.easingFunctions.sampleBatch",
+			"roxy.easingFunctions.setLUTEnabled",
+			"roxy.easingFunctions.getLUTError",
+			"roxy.easingFunctions.benchmarkLUT"
 		};
 		int (*easingFuncs[])(lua_State*) = {
 			roxy_ease_flat_l,
@@ -147,7 +241,11 @@ int eventHandler(PlaydateAPI* playdate, PDSystemEvent event, uint32_t arg) {
 			roxy_ease_out_bounce_l,
 			roxy_ease_in_bounce_l,
 			roxy_ease_in_out_bounce_l,
-			roxy_ease_out_in_bounce_l
+			roxy_ease_out_in_bounce_l,
+			roxy_ease_sampleBatch_l,
+			roxy_ease_setLUTEnabled_l,
+			roxy_ease_getLUTError_l,
+			roxy_ease_benchmarkLUT_l
 		};
 		for (int i = 0; i < sizeof(easingFunctions) / sizeof(easingFunctions[0]); ++i) {
 			if (!pd->lua->addFunction(easingFuncs[i], easingFunctions[i], &error)) {
@@ -156,9 +254,53 @@ int eventHandler(PlaydateAPI* playdate, PDSystemEvent event, uint32_t arg) {
 			}
 		}
 		
+		// ! Register Easing Identifiers
+		// Exposed as roxy.easingFunctions.id.<name>, matching RoxyEaseType in roxy_ease.h
+		static const lua_reg noFunctions[] = { { NULL, NULL } };
+		lua_val easingIds[kRoxyEaseCount + 1];
+		for (int i = 0; i < kRoxyEaseCount; ++i) {
+			easingIds[i].name = easingFunctions[i] + strlen("roxy.easingFunctions.");
+			easingIds[i].type = kInt;
+			easingIds[i].v.intval = i;
+		}
+		easingIds[kRoxyEaseCount].name = NULL;
+		if (!pd->lua->registerClass("roxy.easingFunctions.id", noFunctions, easingIds, 1, &error)) {
+			pd->system->logToConsole("%s:%i: registerClass failed, %s", __FILE__, __LINE__, error);
+			return -1;
+		}
+		
+		roxy_curve_setPlaydateAPI(pd);
+		
+		// ! Register Custom Easing Curves
+		if (!roxy_curve_registerClass(&error)) {
+			pd->system->logToConsole("%s:%i: registerClass failed, %s", __FILE__, __LINE__, error);
+			return -1;
+		}
+		const char* curveFunctions[] = {
+			"roxy.easingFunctions.cubicBezier",
+			"roxy.easingFunctions.piecewise"
+		};
+		int (*curveFuncs[])(lua_State*) = {
+			roxy_curve_newCubicBezier_l,
+			roxy_curve_newPiecewise_l
+		};
+		for (int i = 0; i < sizeof(curveFunctions) / sizeof(curveFunctions[0]); ++i) {
+			if (!pd->lua->addFunction(curveFuncs[i], curveFunctions[i], &error)) {
+				pd->system->logToConsole("%s:%i: addFunction failed, %s", __FILE__, __LINE__, error);
+				return -1;
+			}
+		}
+		
 		roxy_input_setPlaydateAPI(pd);
+		roxy_crank_setPlaydateAPI(pd);
+		roxy_input_recorder_setPlaydateAPI(pd);
+		roxy_combo_setPlaydateAPI(pd);
 		
 		// ! Register Input Functions
+		if (!roxy_input_registerConstants(&error)) {
+			pd->system->logToConsole("%s:%i: registerClass failed, %s", __FILE__, __LINE__, error);
+			return -1;
+		}
 		const char* inputFunctions[] = {
 			"roxy.input.setCustomHoldThreshold",
 			"roxy.input.setButtonHoldBufferAmount",
@@ -167,7 +309,31 @@ int eventHandler(PlaydateAPI* playdate, PDSystemEvent event, uint32_t arg) {
 			"roxy.input.processButtonUp",
 			"roxy.input.processButtonDown",
 			"roxy.input.processButtonLeft",
-			"roxy.input.processButtonRight"
+			"roxy.input.processButtonRight",
+			"roxy.input.poll",
+			"roxy.input.reset",
+			"roxy.input.updateCrank",
+			"roxy.input.getCrankState",
+			"roxy.input.setCrankTicksPerRevolution",
+			"roxy.input.setCrankSmoothing",
+			"roxy.input.setCrankDirection",
+			"roxy.input.resetCrank",
+			"roxy.input.beginFrame",
+			"roxy.input.startRecording",
+			"roxy.input.stopRecording",
+			"roxy.input.isRecording",
+			"roxy.input.saveRecording",
+			"roxy.input.loadRecording",
+			"roxy.input.startReplay",
+			"roxy.input.stopReplay",
+			"roxy.input.isReplaying",
+			"roxy.input.getRecordingInfo",
+			"roxy.input.addCombo",
+			"roxy.input.removeCombo",
+			"roxy.input.clearCombos",
+			"roxy.input.resetCombos",
+			"roxy.input.updateCombos",
+			"roxy.input.popCombos"
 		};
 		int (*inputFuncs[])(lua_State*) = {
 			roxy_input_setCustomHoldThreshold_l,
@@ -177,7 +343,31 @@ int eventHandler(PlaydateAPI* playdate, PDSystemEvent event, uint32_t arg) {
 			roxy_input_processButtonUp_l,
 			roxy_input_processButtonDown_l,
 			roxy_input_processButtonLeft_l,
-			roxy_input_processButtonRight_l
+			roxy_input_processButtonRight_l,
+			roxy_input_poll_l,
+			roxy_input_reset_l,
+			roxy_crank_update_l,
+			roxy_crank_getState_l,
+			roxy_crank_setTicksPerRevolution_l,
+			roxy_crank_setSmoothing_l,
+			roxy_crank_setDirection_l,
+			roxy_crank_reset_l,
+			roxy_input_recorder_beginFrame_l,
+			roxy_input_recorder_startRecording_l,
+			roxy_input_recorder_stopRecording_l,
+			roxy_input_recorder_isRecording_l,
+			roxy_input_recorder_save_l,
+			roxy_input_recorder_load_l,
+			roxy_input_recorder_startReplay_l,
+			roxy_input_recorder_stopReplay_l,
+			roxy_input_recorder_isReplaying_l,
+			roxy_input_recorder_getInfo_l,
+			roxy_combo_add_l,
+			roxy_combo_remove_l,
+			roxy_combo_clear_l,
+			roxy_combo_reset_l,
+			roxy_combo_update_l,
+			roxy_combo_pop_l
 		};
 		for (int i = 0; i < sizeof(inputFunctions) / sizeof(inputFunctions[0]); ++i) {
 			if (!pd->lua->addFunction(inputFuncs[i], inputFunctions[i], &error)) {
@@ -189,11 +379,29 @@ int eventHandler(PlaydateAPI* playdate, PDSystemEvent event, uint32_t arg) {
 		roxy_sequence_setPlaydateAPI(pd);
 		
 		// ! Register Sequence Functions
+		if (!roxy_sequence_registerClass(&error)) {
+			pd->system->logToConsole("%s:%i: registerClass failed, %s", __FILE__, __LINE__, error);
+			return -1;
+		}
 		const char* sequenceFunctions[] = {
 			"roxy.sequence.getClampedTime",
+			"roxy.sequence.getClampedTimes",
+			"roxy.sequence.new",
+			"roxy.sequence.updateAll",
+			"roxy.sequence.popEvents",
+			"roxy.sequence.stopAll",
+			"roxy.sequence.getRunningCount",
+			"roxy.sequence.reservePool"
 		};
 		int (*sequenceFuncs[])(lua_State*) = {
 			roxy_sequence_getClampedTime_l,
+			roxy_sequence_getClampedTimes_l,
+			roxy_sequence_new_l,
+			roxy_sequence_updateAll_l,
+			roxy_sequence_popEvents_l,
+			roxy_sequence_stopAll_l,
+			roxy_sequence_getRunningCount_l,
+			roxy_sequence_reservePool_l
 		};
 		for (int i = 0; i < sizeof(sequenceFunctions) / sizeof(sequenceFunctions[0]); ++i) {
 			if (!pd->lua->addFunction(sequenceFuncs[i], sequenceFunctions[i], &error)) {
@@ -204,25 +412,3 @@ int eventHandler(PlaydateAPI* playdate, PDSystemEvent event, uint32_t arg) {
 	}
 	return 0;
 }
-
-// Calculates the time difference between frames and updates deltaTime for 
-// use in Lua scripts
-static int updateDeltaTime_l(lua_State* L) {
-	(void)L;
-	
-	if (pd == NULL) {
-		return 0;
-	}
-	
-	uint32_t currentTime = pd->system->getCurrentTimeMilliseconds();
-	
-	if (previousTime == 0) {
-		previousTime = currentTime;  // Initialize previousTime on first call
-	}
-	
-	deltaTime = (currentTime - previousTime) / 1000.0f;
-	previousTime = currentTime;
-	
-	pd->lua->pushFloat(deltaTime);
-	return 1;
-}
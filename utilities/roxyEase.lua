@@ -76,3 +76,41 @@ function roxy.easingFunctions.reverse(easingFunction)
 	if reverseFunctions[easingFunction] == nil then return nil end
 	return reverseFunctions[easingFunction]
 end
+
+-- Maps each built-in easing function to its C identifier (`roxy.easingFunctions.id`, `RoxyEaseType` in roxy_ease.h).
+local easeIds = {}
+for name, id in pairs(Ease.id) do
+	easeIds[Ease[name]] = id
+end
+
+-- Returns the C identifier of a built-in easing function, or `nil` for custom Lua easing functions.
+-- Identifiers let native code (sequences, transitions, batch sampling) evaluate easings without calling back into Lua.
+function roxy.easingFunctions.getId(easingFunction)
+	return easeIds[easingFunction]
+end
+
+-- Maximum samples returned by one `sampleBatch` call; see `ROXY_EASE_MAX_BATCH_SAMPLES` in roxy_ease.h
+local MAX_BATCH_SAMPLES <const> = 16
+
+-- Copies a variable number of values into `out`, starting at `index`, one value per call
+local function fillTable(out, index, value, ...)
+	if value == nil then return end
+	out[index] = value
+	return fillTable(out, index + 1, ...)
+end
+
+-- Samples an easing `count` times, starting at `t0` and stepping by `dt`, in calls into C of up to 16 samples.
+-- The results are written into `out` (reused across frames to avoid allocations) and `out` is returned along with the sample count.
+-- `easing` may be a built-in easing function or an identifier from `roxy.easingFunctions.id`.
+function roxy.easingFunctions.sampleBatchInto(out, easing, t0, dt, count, b, c, d)
+	local easeId = type(easing) == "number" and easing or easeIds[easing]
+	if easeId == nil then
+		warn("Warning: sampleBatchInto only supports Roxy's built-in easing functions.")
+		return out, 0
+	end
+	for offset = 0, count - 1, MAX_BATCH_SAMPLES do
+		local batchCount = math.min(MAX_BATCH_SAMPLES, count - offset)
+		fillTable(out, offset + 1, Ease.sampleBatch(easeId, t0 + dt * offset, dt, batchCount, b, c, d))
+	end
+	return out, math.max(count, 0)
+end
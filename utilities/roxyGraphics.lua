@@ -3,7 +3,7 @@ local Display <const> = pd.display
 local Graphics <const> = pd.graphics
 
 roxy = roxy or {}
-roxy.graphics = {}
+roxy.graphics = roxy.graphics or {}  -- Frame capture functions are added in C (roxy_graphics.c)
 
 -- Returns the display's refresh rate, caching it after the first successful retrieval.
 -- If the refresh rate is already cached, it returns the cached value.
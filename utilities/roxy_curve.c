@@ -0,0 +1,251 @@
+#include "roxy_curve.h"
+#include "roxy_math.h"
+#include <math.h>
+
+static PlaydateAPI* pd = NULL;
+
+void roxy_curve_setPlaydateAPI(PlaydateAPI* playdate) {
+	pd = playdate;
+}
+
+// Evaluates one coordinate of a cubic Bézier segment at parameter t
+static inline float bezier(float p0, float p1, float p2, float p3, float t) {
+	float mt = 1.0f - t;
+	return mt * mt * mt * p0 + 3.0f * mt * mt * t * p1 + 3.0f * mt * t * t * p2 + t * t * t * p3;
+}
+
+// Derivative of one coordinate of a cubic Bézier segment at parameter t
+static inline float bezierDerivative(float p0, float p1, float p2, float p3, float t) {
+	float mt = 1.0f - t;
+	return 3.0f * mt * mt * (p1 - p0) + 6.0f * mt * t * (p2 - p1) + 3.0f * t * t * (p3 - p2);
+}
+
+// Allocates a curve and builds its sampled x -> t table
+static RoxyCurve* newCurve(int segmentCount) {
+	RoxyCurve* curve = pd->system->realloc(NULL, sizeof(RoxyCurve));
+	if (curve == NULL) {
+		return NULL;
+	}
+	curve->segmentCount = segmentCount;
+	curve->sampleCount = segmentCount * ROXY_CURVE_SAMPLES_PER_SEGMENT + 1;
+	curve->points = pd->system->realloc(NULL, sizeof(float) * 8 * segmentCount);
+	curve->samples = pd->system->realloc(NULL, sizeof(float) * curve->sampleCount);
+	if (curve->points == NULL || curve->samples == NULL) {
+		roxy_curve_free(curve);
+		return NULL;
+	}
+	return curve;
+}
+
+static void buildSamples(RoxyCurve* curve) {
+	for (int i = 0; i < curve->sampleCount; ++i) {
+		int segment = i / ROXY_CURVE_SAMPLES_PER_SEGMENT;
+		float t = (float)(i % ROXY_CURVE_SAMPLES_PER_SEGMENT) / ROXY_CURVE_SAMPLES_PER_SEGMENT;
+		if (segment == curve->segmentCount) {
+			segment--;  // The final sample is the end of the last segment
+			t = 1.0f;
+		}
+		const float* p = &curve->points[segment * 8];
+		curve->samples[i] = bezier(p[0], p[2], p[4], p[6], t);
+	}
+}
+
+RoxyCurve* roxy_curve_newCubicBezier(float x1, float y1, float x2, float y2) {
+	RoxyCurve* curve = newCurve(1);
+	if (curve == NULL) {
+		return NULL;
+	}
+	
+	// Control point x values outside [0, 1] would make x non-monotonic
+	float points[8] = {
+		0.0f, 0.0f,
+		roxy_math_clamp(x1, 0.0f, 1.0f), y1,
+		roxy_math_clamp(x2, 0.0f, 1.0f), y2,
+		1.0f, 1.0f
+	};
+	memcpy(curve->points, points, sizeof(points));
+	buildSamples(curve);
+	return curve;
+}
+
+RoxyCurve* roxy_curve_newPiecewise(const float* segments, int segmentCount) {
+	if (segmentCount < 1 || segmentCount > ROXY_CURVE_MAX_SEGMENTS) {
+		return NULL;
+	}
+	
+	RoxyCurve* curve = newCurve(segmentCount);
+	if (curve == NULL) {
+		return NULL;
+	}
+	
+	float startX = 0.0f;
+	float startY = 0.0f;
+	for (int i = 0; i < segmentCount; ++i) {
+		const float* s = &segments[i * 6];
+		float endX = (i == segmentCount - 1) ? 1.0f : roxy_math_clamp(s[4], startX, 1.0f);
+		float* p = &curve->points[i * 8];
+		p[0] = startX;
+		p[1] = startY;
+		p[2] = roxy_math_clamp(s[0], startX, endX);
+		p[3] = s[1];
+		p[4] = roxy_math_clamp(s[2], startX, endX);
+		p[5] = s[3];
+		p[6] = endX;
+		p[7] = s[5];
+		startX = endX;
+		startY = s[5];
+	}
+	buildSamples(curve);
+	return curve;
+}
+
+void roxy_curve_free(RoxyCurve* curve) {
+	if (curve == NULL) {
+		return;
+	}
+	if (curve->points != NULL) {
+		pd->system->realloc(curve->points, 0);
+	}
+	if (curve->samples != NULL) {
+		pd->system->realloc(curve->samples, 0);
+	}
+	pd->system->realloc(curve, 0);
+}
+
+float roxy_curve_evaluate(const RoxyCurve* curve, float u) {
+	const float* samples = curve->samples;
+	int last = curve->sampleCount - 1;
+	
+	if (u <= samples[0]) {
+		return curve->points[1];
+	}
+	if (u >= samples[last]) {
+		return curve->points[(curve->segmentCount - 1) * 8 + 7];
+	}
+	
+	// Binary search for the sample interval containing u
+	int low = 0;
+	int high = last;
+	while (high - low > 1) {
+		int middle = (low + high) / 2;
+		if (samples[middle] <= u) {
+			low = middle;
+		} else {
+			high = middle;
+		}
+	}
+	
+	// Initial guess for the segment parameter from linear interpolation between samples
+	float span = samples[high] - samples[low];
+	float fraction = span > 0.0f ? (u - samples[low]) / span : 0.0f;
+	int segment = low / ROXY_CURVE_SAMPLES_PER_SEGMENT;
+	float t = ((low % ROXY_CURVE_SAMPLES_PER_SEGMENT) + fraction) / ROXY_CURVE_SAMPLES_PER_SEGMENT;
+	const float* p = &curve->points[segment * 8];
+	
+	// A few Newton iterations refine t so that x(t) = u
+	for (int i = 0; i < 3; ++i) {
+		float slope = bezierDerivative(p[0], p[2], p[4], p[6], t);
+		if (fabsf(slope) < 1e-6f) {
+			break;
+		}
+		t -= (bezier(p[0], p[2], p[4], p[6], t) - u) / slope;
+	}
+	t = roxy_math_clamp(t, 0.0f, 1.0f);
+	
+	return bezier(p[1], p[3], p[5], p[7], t);
+}
+
+float roxy_curve_ease(const RoxyCurve* curve, float t, float b, float c, float d) {
+	if (d == 0.0f) {
+		return b + c;
+	}
+	return b + c * roxy_curve_evaluate(curve, t / d);
+}
+
+// ! Lua Bindings
+
+static RoxyCurve* getCurveArg(int position) {
+	return pd->lua->getArgObject(position, ROXY_CURVE_CLASS, NULL);
+}
+
+static int pushCurve(RoxyCurve* curve) {
+	if (curve == NULL) {
+		pd->system->logToConsole("Warning: Failed to create curve.");
+		pd->lua->pushNil();
+		return 1;
+	}
+	pd->lua->pushObject(curve, ROXY_CURVE_CLASS, 0);
+	return 1;
+}
+
+// roxy.easingFunctions.cubicBezier(x1, y1, x2, y2)
+int roxy_curve_newCubicBezier_l(lua_State* L) {
+	(void)L;
+	
+	float x1 = pd->lua->getArgFloat(1);
+	float y1 = pd->lua->getArgFloat(2);
+	float x2 = pd->lua->getArgFloat(3);
+	float y2 = pd->lua->getArgFloat(4);
+	return pushCurve(roxy_curve_newCubicBezier(x1, y1, x2, y2));
+}
+
+// roxy.easingFunctions.piecewise(c1x, c1y, c2x, c2y, endX, endY, ...)
+int roxy_curve_newPiecewise_l(lua_State* L) {
+	(void)L;
+	
+	int argCount = pd->lua->getArgCount();
+	int segmentCount = argCount / 6;
+	if (segmentCount < 1 || segmentCount > ROXY_CURVE_MAX_SEGMENTS || argCount % 6 != 0) {
+		pd->system->logToConsole("Warning: piecewise expects 6 numbers per segment and at most %d segments.", ROXY_CURVE_MAX_SEGMENTS);
+		pd->lua->pushNil();
+		return 1;
+	}
+	
+	float segments[ROXY_CURVE_MAX_SEGMENTS * 6];
+	for (int i = 0; i < argCount; ++i) {
+		segments[i] = pd->lua->getArgFloat(i + 1);
+	}
+	return pushCurve(roxy_curve_newPiecewise(segments, segmentCount));
+}
+
+// curve(t, b, c, d) and curve:ease(t, b, c, d), so curves can be used anywhere an easing function is expected
+static int roxy_curve_ease_l(lua_State* L) {
+	(void)L;
+	
+	RoxyCurve* curve = getCurveArg(1);
+	float t = pd->lua->getArgFloat(2);
+	float b = pd->lua->getArgFloat(3);
+	float c = pd->lua->getArgFloat(4);
+	float d = pd->lua->getArgFloat(5);
+	pd->lua->pushFloat(curve ? roxy_curve_ease(curve, t, b, c, d) : b);
+	return 1;
+}
+
+// curve:evaluate(x)
+static int roxy_curve_evaluate_l(lua_State* L) {
+	(void)L;
+	
+	RoxyCurve* curve = getCurveArg(1);
+	float u = pd->lua->getArgFloat(2);
+	pd->lua->pushFloat(curve ? roxy_curve_evaluate(curve, u) : 0.0f);
+	return 1;
+}
+
+static int roxy_curve_gc_l(lua_State* L) {
+	(void)L;
+	
+	roxy_curve_free(getCurveArg(1));
+	return 0;
+}
+
+static const lua_reg curveClass[] = {
+	{ "__gc", roxy_curve_gc_l },
+	{ "__call", roxy_curve_ease_l },
+	{ "ease", roxy_curve_ease_l },
+	{ "evaluate", roxy_curve_evaluate_l },
+	{ NULL, NULL }
+};
+
+int roxy_curve_registerClass(const char** outErr) {
+	return pd->lua->registerClass(ROXY_CURVE_CLASS, curveClass, NULL, 0, outErr);
+}
@@ -0,0 +1,49 @@
+#ifndef ROXY_CURVE_H
+#define ROXY_CURVE_H
+
+#include "pd_api.h"
+
+// Lua class name for curve userdata
+#define ROXY_CURVE_CLASS "roxy.curve"
+
+// Number of x -> t samples taken per cubic segment when a curve is created
+#define ROXY_CURVE_SAMPLES_PER_SEGMENT 16
+
+// Maximum number of cubic segments in a piecewise curve
+#define ROXY_CURVE_MAX_SEGMENTS 16
+
+// Custom easing curve made of one or more cubic Bézier segments spanning x = 0 to x = 1.
+// Each segment stores its four control points as x0, y0, x1, y1, x2, y2, x3, y3.
+typedef struct {
+	int segmentCount;
+	float* points;		// 8 floats per segment
+	float* samples;		// x at evenly spaced parameters, segmentCount * ROXY_CURVE_SAMPLES_PER_SEGMENT + 1 entries
+	int sampleCount;
+} RoxyCurve;
+
+void roxy_curve_setPlaydateAPI(PlaydateAPI* playdate);
+
+// Creates a CSS-style cubic-bezier(x1, y1, x2, y2) curve from (0, 0) to (1, 1)
+RoxyCurve* roxy_curve_newCubicBezier(float x1, float y1, float x2, float y2);
+
+// Creates a piecewise curve from `segmentCount` segments starting at (0, 0).
+// Each segment is given by 6 floats: control point 1, control point 2 and end point (x, y).
+// The end point x values must increase and the last one must be 1.
+RoxyCurve* roxy_curve_newPiecewise(const float* segments, int segmentCount);
+
+void roxy_curve_free(RoxyCurve* curve);
+
+// Returns the curve's y value at x = u (clamped to [0, 1])
+float roxy_curve_evaluate(const RoxyCurve* curve, float u);
+
+// Evaluates the curve as an easing function (t = elapsed, b = begin, c = change, d = duration)
+float roxy_curve_ease(const RoxyCurve* curve, float t, float b, float c, float d);
+
+// Registers the roxy.curve userdata class with Lua
+int roxy_curve_registerClass(const char** outErr);
+
+// Lua wrapper function prototypes
+int roxy_curve_newCubicBezier_l(lua_State* L);
+int roxy_curve_newPiecewise_l(lua_State* L);
+
+#endif /* ROXY_CURVE_H */
@@ -444,7 +444,7 @@ int roxy_ease_in_sine_l(lua_State* L) {
 	float b = pd->lua->getArgFloat(2);
 	float c = pd->lua->getArgFloat(3);
 	float d = pd->lua->getArgFloat(4);
-	float result = roxy_ease_in_sine(t, b, c, d);
+	float result = roxy_ease_evaluate(kRoxyEaseInSine, t, b, c, d);
 	
 	pd->lua->pushFloat(result);
 	return 1;
@@ -463,7 +463,7 @@ int roxy_ease_out_sine_l(lua_State* L) {
 	float b = pd->lua->getArgFloat(2);
 	float c = pd->lua->getArgFloat(3);
 	float d = pd->lua->getArgFloat(4);
-	float result = roxy_ease_out_sine(t, b, c, d);
+	float result = roxy_ease_evaluate(kRoxyEaseOutSine, t, b, c, d);
 	
 	pd->lua->pushFloat(result);
 	return 1;
@@ -482,7 +482,7 @@ int roxy_ease_in_out_sine_l(lua_State* L) {
 	float b = pd->lua->getArgFloat(2);
 	float c = pd->lua->getArgFloat(3);
 	float d = pd->lua->getArgFloat(4);
-	float result = roxy_ease_in_out_sine(t, b, c, d);
+	float result = roxy_ease_evaluate(kRoxyEaseInOutSine, t, b, c, d);
 	
 	pd->lua->pushFloat(result);
 	return 1;
@@ -505,7 +505,7 @@ int roxy_ease_out_in_sine_l(lua_State* L) {
 	float b = pd->lua->getArgFloat(2);
 	float c = pd->lua->getArgFloat(3);
 	float d = pd->lua->getArgFloat(4);
-	float result = roxy_ease_out_in_sine(t, b, c, d);
+	float result = roxy_ease_evaluate(kRoxyEaseOutInSine, t, b, c, d);
 	
 	pd->lua->pushFloat(result);
 	return 1;
@@ -525,7 +525,7 @@ int roxy_ease_in_expo_l(lua_State* L) {
 	float b = pd->lua->getArgFloat(2);
 	float c = pd->lua->getArgFloat(3);
 	float d = pd->lua->getArgFloat(4);
-	float result = roxy_ease_in_expo(t, b, c, d);
+	float result = roxy_ease_evaluate(kRoxyEaseInExpo, t, b, c, d);
 	
 	pd->lua->pushFloat(result);
 	return 1;
@@ -545,7 +545,7 @@ int roxy_ease_out_expo_l(lua_State* L) {
 	float b = pd->lua->getArgFloat(2);
 	float c = pd->lua->getArgFloat(3);
 	float d = pd->lua->getArgFloat(4);
-	float result = roxy_ease_out_expo(t, b, c, d);
+	float result = roxy_ease_evaluate(kRoxyEaseOutExpo, t, b, c, d);
 	
 	pd->lua->pushFloat(result);
 	return 1;
@@ -572,7 +572,7 @@ int roxy_ease_in_out_expo_l(lua_State* L) {
 	float b = pd->lua->getArgFloat(2);
 	float c = pd->lua->getArgFloat(3);
 	float d = pd->lua->getArgFloat(4);
-	float result = roxy_ease_in_out_expo(t, b, c, d);
+	float result = roxy_ease_evaluate(kRoxyEaseInOutExpo, t, b, c, d);
 	
 	pd->lua->pushFloat(result);
 	return 1;
@@ -595,7 +595,7 @@ int roxy_ease_out_in_expo_l(lua_State* L) {
 	float b = pd->lua->getArgFloat(2);
 	float c = pd->lua->getArgFloat(3);
 	float d = pd->lua->getArgFloat(4);
-	float result = roxy_ease_out_in_expo(t, b, c, d);
+	float result = roxy_ease_evaluate(kRoxyEaseOutInExpo, t, b, c, d);
 	
 	pd->lua->pushFloat(result);
 	return 1;
@@ -615,7 +615,7 @@ int roxy_ease_in_circ_l(lua_State* L) {
 	float b = pd->lua->getArgFloat(2);
 	float c = pd->lua->getArgFloat(3);
 	float d = pd->lua->getArgFloat(4);
-	float result = roxy_ease_in_circ(t, b, c, d);
+	float result = roxy_ease_evaluate(kRoxyEaseInCirc, t, b, c, d);
 	
 	pd->lua->pushFloat(result);
 	return 1;
@@ -635,7 +635,7 @@ int roxy_ease_out_circ_l(lua_State* L) {
 	float b = pd->lua->getArgFloat(2);
 	float c = pd->lua->getArgFloat(3);
 	float d = pd->lua->getArgFloat(4);
-	float result = roxy_ease_out_circ(t, b, c, d);
+	float result = roxy_ease_evaluate(kRoxyEaseOutCirc, t, b, c, d);
 	
 	pd->lua->pushFloat(result);
 	return 1;
@@ -660,7 +660,7 @@ int roxy_ease_in_out_circ_l(lua_State* L) {
 	float b = pd->lua->getArgFloat(2);
 	float c = pd->lua->getArgFloat(3);
 	float d = pd->lua->getArgFloat(4);
-	float result = roxy_ease_in_out_circ(t, b, c, d);
+	float result = roxy_ease_evaluate(kRoxyEaseInOutCirc, t, b, c, d);
 	
 	pd->lua->pushFloat(result);
 	return 1;
@@ -683,7 +683,7 @@ int roxy_ease_out_in_circ_l(lua_State* L) {
 	float b = pd->lua->getArgFloat(2);
 	float c = pd->lua->getArgFloat(3);
 	float d = pd->lua->getArgFloat(4);
-	float result = roxy_ease_out_in_circ(t, b, c, d);
+	float result = roxy_ease_evaluate(kRoxyEaseOutInCirc, t, b, c, d);
 	
 	pd->lua->pushFloat(result);
 	return 1;
@@ -714,9 +714,9 @@ int roxy_ease_in_elastic_l(lua_State* L) {
 	float b = pd->lua->getArgFloat(2);
 	float c = pd->lua->getArgFloat(3);
 	float d = pd->lua->getArgFloat(4);
-	float a = (pd->lua->getArgCount() > 4) ? pd->lua->getArgFloat(5) : 1.0f;
-	float p = (pd->lua->getArgCount() > 5) ? pd->lua->getArgFloat(6) : 0.3f;
-	float result = roxy_ease_in_elastic(t, b, c, d, a, p);
+	float a = (pd->lua->getArgCount() > 4) ? pd->lua->getArgFloat(5) : ROXY_EASE_DEFAULT_ELASTIC_AMPLITUDE;
+	float p = (pd->lua->getArgCount() > 5) ? pd->lua->getArgFloat(6) : ROXY_EASE_DEFAULT_ELASTIC_PERIOD;
+	float result = roxy_ease_evaluateWithParams(kRoxyEaseInElastic, t, b, c, d, a, p);
 	
 	pd->lua->pushFloat(result);
 	return 1;
@@ -746,9 +746,9 @@ int roxy_ease_out_elastic_l(lua_State* L) {
 	float b = pd->lua->getArgFloat(2);
 	float c = pd->lua->getArgFloat(3);
 	float d = pd->lua->getArgFloat(4);
-	float a = (pd->lua->getArgCount() > 4) ? pd->lua->getArgFloat(5) : 1.0f;
-	float p = (pd->lua->getArgCount() > 5) ? pd->lua->getArgFloat(6) : 0.3f;
-	float result = roxy_ease_out_elastic(t, b, c, d, a, p);
+	float a = (pd->lua->getArgCount() > 4) ? pd->lua->getArgFloat(5) : ROXY_EASE_DEFAULT_ELASTIC_AMPLITUDE;
+	float p = (pd->lua->getArgCount() > 5) ? pd->lua->getArgFloat(6) : ROXY_EASE_DEFAULT_ELASTIC_PERIOD;
+	float result = roxy_ease_evaluateWithParams(kRoxyEaseOutElastic, t, b, c, d, a, p);
 	
 	pd->lua->pushFloat(result);
 	return 1;
@@ -785,9 +785,9 @@ int roxy_ease_in_out_elastic_l(lua_State* L) {
 	float b = pd->lua->getArgFloat(2);
 	float c = pd->lua->getArgFloat(3);
 	float d = pd->lua->getArgFloat(4);
-	float a = (pd->lua->getArgCount() > 4) ? pd->lua->getArgFloat(5) : 1.0f;
-	float p = (pd->lua->getArgCount() > 5) ? pd->lua->getArgFloat(6) : 0.3f;
-	float result = roxy_ease_in_out_elastic(t, b, c, d, a, p);
+	float a = (pd->lua->getArgCount() > 4) ? pd->lua->getArgFloat(5) : ROXY_EASE_DEFAULT_ELASTIC_AMPLITUDE;
+	float p = (pd->lua->getArgCount() > 5) ? pd->lua->getArgFloat(6) : ROXY_EASE_DEFAULT_ELASTIC_PERIOD;
+	float result = roxy_ease_evaluateWithParams(kRoxyEaseInOutElastic, t, b, c, d, a, p);
 	
 	pd->lua->pushFloat(result);
 	return 1;
@@ -810,9 +810,9 @@ int roxy_ease_out_in_elastic_l(lua_State* L) {
 	float b = pd->lua->getArgFloat(2);
 	float c = pd->lua->getArgFloat(3);
 	float d = pd->lua->getArgFloat(4);
-	float a = (pd->lua->getArgCount() > 4) ? pd->lua->getArgFloat(5) : 1.0f;
-	float p = (pd->lua->getArgCount() > 5) ? pd->lua->getArgFloat(6) : 0.3f;
-	float result = roxy_ease_out_in_elastic(t, b, c, d, a, p);
+	float a = (pd->lua->getArgCount() > 4) ? pd->lua->getArgFloat(5) : ROXY_EASE_DEFAULT_ELASTIC_AMPLITUDE;
+	float p = (pd->lua->getArgCount() > 5) ? pd->lua->getArgFloat(6) : ROXY_EASE_DEFAULT_ELASTIC_PERIOD;
+	float result = roxy_ease_evaluateWithParams(kRoxyEaseOutInElastic, t, b, c, d, a, p);
 	
 	pd->lua->pushFloat(result);
 	return 1;
@@ -1009,3 +1009,399 @@ int roxy_ease_out_in_bounce_l(lua_State* L) {
 	pd->lua->pushFloat(result);
 	return 1;
 }
+
+// ! Dispatch Tables
+
+// Four-argument adapters for the parameterized easings, using the same defaults as their Lua wrappers
+static float roxy_ease_in_elastic_default(float t, float b, float c, float d) {
+	return roxy_ease_in_elastic(t, b, c, d, ROXY_EASE_DEFAULT_ELASTIC_AMPLITUDE, ROXY_EASE_DEFAULT_ELASTIC_PERIOD);
+}
+
+static float roxy_ease_out_elastic_default(float t, float b, float c, float d) {
+	return roxy_ease_out_elastic(t, b, c, d, ROXY_EASE_DEFAULT_ELASTIC_AMPLITUDE, ROXY_EASE_DEFAULT_ELASTIC_PERIOD);
+}
+
+static float roxy_ease_in_out_elastic_default(float t, float b, float c, float d) {
+	return roxy_ease_in_out_elastic(t, b, c, d, ROXY_EASE_DEFAULT_ELASTIC_AMPLITUDE, ROXY_EASE_DEFAULT_ELASTIC_PERIOD);
+}
+
+static float roxy_ease_out_in_elastic_default(float t, float b, float c, float d) {
+	return roxy_ease_out_in_elastic(t, b, c, d, ROXY_EASE_DEFAULT_ELASTIC_AMPLITUDE, ROXY_EASE_DEFAULT_ELASTIC_PERIOD);
+}
+
+static float roxy_ease_in_back_default(float t, float b, float c, float d) {
+	return roxy_ease_in_back(t, b, c, d, ROXY_EASE_DEFAULT_BACK_OVERSHOOT);
+}
+
+static float roxy_ease_out_back_default(float t, float b, float c, float d) {
+	return roxy_ease_out_back(t, b, c, d, ROXY_EASE_DEFAULT_BACK_OVERSHOOT);
+}
+
+static float roxy_ease_in_out_back_default(float t, float b, float c, float d) {
+	return roxy_ease_in_out_back(t, b, c, d, ROXY_EASE_DEFAULT_BACK_OVERSHOOT);
+}
+
+static float roxy_ease_out_in_back_default(float t, float b, float c, float d) {
+	return roxy_ease_out_in_back(t, b, c, d, ROXY_EASE_DEFAULT_BACK_OVERSHOOT);
+}
+
+// Back easings take a single overshoot parameter; adapt them to the two-parameter signature
+static float roxy_ease_in_back_params(float t, float b, float c, float d, float s, float unused) {
+	(void)unused;
+	return roxy_ease_in_back(t, b, c, d, s);
+}
+
+static float roxy_ease_out_back_params(float t, float b, float c, float d, float s, float unused) {
+	(void)unused;
+	return roxy_ease_out_back(t, b, c, d, s);
+}
+
+static float roxy_ease_in_out_back_params(float t, float b, float c, float d, float s, float unused) {
+	(void)unused;
+	return roxy_ease_in_out_back(t, b, c, d, s);
+}
+
+static float roxy_ease_out_in_back_params(float t, float b, float c, float d, float s, float unused) {
+	(void)unused;
+	return roxy_ease_out_in_back(t, b, c, d, s);
+}
+
+const RoxyEaseFunction roxy_ease_functions[kRoxyEaseCount] = {
+	[kRoxyEaseFlat]			= roxy_ease_flat,
+	[kRoxyEaseLinear]		= roxy_ease_linear,
+	[kRoxyEaseInQuad]		= roxy_ease_in_quad,
+	[kRoxyEaseOutQuad]		= roxy_ease_out_quad,
+	[kRoxyEaseInOutQuad]	= roxy_ease_in_out_quad,
+	[kRoxyEaseOutInQuad]	= roxy_ease_out_in_quad,
+	[kRoxyEaseInCubic]		= roxy_ease_in_cubic,
+	[kRoxyEaseOutCubic]		= roxy_ease_out_cubic,
+	[kRoxyEaseInOutCubic]	= roxy_ease_in_out_cubic,
+	[kRoxyEaseOutInCubic]	= roxy_ease_out_in_cubic,
+	[kRoxyEaseInQuart]		= roxy_ease_in_quart,
+	[kRoxyEaseOutQuart]		= roxy_ease_out_quart,
+	[kRoxyEaseInOutQuart]	= roxy_ease_in_out_quart,
+	[kRoxyEaseOutInQuart]	= roxy_ease_out_in_quart,
+	[kRoxyEaseInQuint]		= roxy_ease_in_quint,
+	[kRoxyEaseOutQuint]		= roxy_ease_out_quint,
+	[kRoxyEaseInOutQuint]	= roxy_ease_in_out_quint,
+	[kRoxyEaseOutInQuint]	= roxy_ease_out_in_quint,
+	[kRoxyEaseInSine]		= roxy_ease_in_sine,
+	[kRoxyEaseOutSine]		= roxy_ease_out_sine,
+	[kRoxyEaseInOutSine]	= roxy_ease_in_out_sine,
+	[kRoxyEaseOutInSine]	= roxy_ease_out_in_sine,
+	[kRoxyEaseInExpo]		= roxy_ease_in_expo,
+	[kRoxyEaseOutExpo]		= roxy_ease_out_expo,
+	[kRoxyEaseInOutExpo]	= roxy_ease_in_out_expo,
+	[kRoxyEaseOutInExpo]	= roxy_ease_out_in_expo,
+	[kRoxyEaseInCirc]		= roxy_ease_in_circ,
+	[kRoxyEaseOutCirc]		= roxy_ease_out_circ,
+	[kRoxyEaseInOutCirc]	= roxy_ease_in_out_circ,
+	[kRoxyEaseOutInCirc]	= roxy_ease_out_in_circ,
+	[kRoxyEaseInElastic]	= roxy_ease_in_elastic_default,
+	[kRoxyEaseOutElastic]	= roxy_ease_out_elastic_default,
+	[kRoxyEaseInOutElastic]	= roxy_ease_in_out_elastic_default,
+	[kRoxyEaseOutInElastic]	= roxy_ease_out_in_elastic_default,
+	[kRoxyEaseInBack]		= roxy_ease_in_back_default,
+	[kRoxyEaseOutBack]		= roxy_ease_out_back_default,
+	[kRoxyEaseInOutBack]	= roxy_ease_in_out_back_default,
+	[kRoxyEaseOutInBack]	= roxy_ease_out_in_back_default,
+	[kRoxyEaseOutBounce]	= roxy_ease_out_bounce,
+	[kRoxyEaseInBounce]		= roxy_ease_in_bounce,
+	[kRoxyEaseInOutBounce]	= roxy_ease_in_out_bounce,
+	[kRoxyEaseOutInBounce]	= roxy_ease_out_in_bounce
+};
+
+const RoxyEaseParamFunction roxy_ease_param_functions[kRoxyEaseCount] = {
+	[kRoxyEaseInElastic]	= roxy_ease_in_elastic,
+	[kRoxyEaseOutElastic]	= roxy_ease_out_elastic,
+	[kRoxyEaseInOutElastic]	= roxy_ease_in_out_elastic,
+	[kRoxyEaseOutInElastic]	= roxy_ease_out_in_elastic,
+	[kRoxyEaseInBack]		= roxy_ease_in_back_params,
+	[kRoxyEaseOutBack]		= roxy_ease_out_back_params,
+	[kRoxyEaseInOutBack]	= roxy_ease_in_out_back_params,
+	[kRoxyEaseOutInBack]	= roxy_ease_out_in_back_params
+};
+
+// ! Lookup Tables
+// Sine, expo, circ and elastic easings call transcendental functions on every sample.
+// When lookup tables are enabled, each of these curves is baked once into a normalized
+// table (b = 0, c = 1, d = 1) and evaluated as b + c * lerp(table, t / d).
+
+// Normalized curves for the transcendental easings, indexed by RoxyEaseType. Elastic curves depend on
+// their period relative to the duration, so only the default relative period is baked; other periods
+// use the exact functions.
+static float* lutTables[kRoxyEaseCount] = { NULL };
+static int lutEnabled = 0;
+
+// Returns whether an easing is backed by a lookup table when they are enabled
+int roxy_ease_hasLUT(RoxyEaseType type) {
+	return (type >= kRoxyEaseInSine && type <= kRoxyEaseOutInCirc) ||
+		(type >= kRoxyEaseInElastic && type <= kRoxyEaseOutInElastic);
+}
+
+static int isElastic(RoxyEaseType type) {
+	return type >= kRoxyEaseInElastic && type <= kRoxyEaseOutInElastic;
+}
+
+// Samples a normalized curve into a newly allocated table of ROXY_EASE_LUT_SIZE + 1 entries
+static float* bakeTable(RoxyEaseType type) {
+	float* table = pd->system->realloc(NULL, sizeof(float) * (ROXY_EASE_LUT_SIZE + 1));
+	if (table == NULL) {
+		return NULL;
+	}
+	for (int i = 0; i <= ROXY_EASE_LUT_SIZE; ++i) {
+		float u = (float)i / ROXY_EASE_LUT_SIZE;
+		if (isElastic(type)) {
+			// Amplitude 0 matches the change, which keeps the curve normalized, and period 0 is the relative default
+			table[i] = roxy_ease_param_functions[type](u, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f);
+		} else {
+			table[i] = roxy_ease_functions[type](u, 0.0f, 1.0f, 1.0f);
+		}
+	}
+	return table;
+}
+
+// Linearly interpolates a normalized table at u, clamped to [0, 1]
+static inline float sampleTable(const float* table, float u) {
+	if (u <= 0.0f) return table[0];
+	if (u >= 1.0f) return table[ROXY_EASE_LUT_SIZE];
+	float x = u * ROXY_EASE_LUT_SIZE;
+	int i = (int)x;
+	float f = x - (float)i;
+	return table[i] + (table[i + 1] - table[i]) * f;
+}
+
+// Returns whether an elastic easing uses its default period relative to the duration, which its table is baked with
+static int hasBakedPeriod(RoxyEaseType type, float d, float p) {
+	if (p == 0.0f) {
+		return 1;  // The function applies its relative default itself
+	}
+	float defaultPeriod = type == kRoxyEaseInOutElastic ? 0.3f * 1.5f : 0.3f;
+	return fabsf(p / d - defaultPeriod) <= defaultPeriod * 1e-4f;
+}
+
+static void freeTables(void) {
+	for (int i = 0; i < kRoxyEaseCount; ++i) {
+		if (lutTables[i] != NULL) {
+			pd->system->realloc(lutTables[i], 0);
+			lutTables[i] = NULL;
+		}
+	}
+}
+
+// Enables or disables lookup-table evaluation, baking every table when enabled
+void roxy_ease_setLUTEnabled(int enabled) {
+	if (enabled && !lutEnabled) {
+		for (int i = 0; i < kRoxyEaseCount; ++i) {
+			if (roxy_ease_hasLUT((RoxyEaseType)i)) {
+				lutTables[i] = bakeTable((RoxyEaseType)i);
+			}
+		}
+	} else if (!enabled && lutEnabled) {
+		freeTables();
+	}
+	lutEnabled = enabled;
+}
+
+int roxy_ease_isLUTEnabled(void) {
+	return lutEnabled;
+}
+
+// Returns the lookup-table result for an easing, or 0 if the exact path must be used
+static int evaluateLUT(RoxyEaseType type, float t, float b, float c, float d, float a, float p, float* outResult) {
+	if (!lutEnabled || d == 0.0f) {
+		return 0;
+	}
+	
+	if (isElastic(type)) {
+		// Only an amplitude replaced by the change keeps the curve proportional to c. OutInElastic
+		// passes half the change to each of its halves, so its amplitude is compared with that.
+		float change = type == kRoxyEaseOutInElastic ? fabsf(c) * 0.5f : fabsf(c);
+		if (a != 0.0f && a > change) {
+			return 0;
+		}
+		if (!hasBakedPeriod(type, d, p)) {
+			return 0;
+		}
+	}
+	
+	const float* table = lutTables[type];
+	if (table == NULL) {
+		return 0;
+	}
+	
+	*outResult = b + c * sampleTable(table, t / d);
+	return 1;
+}
+
+// Evaluates an easing by identifier
+float roxy_ease_evaluate(RoxyEaseType type, float t, float b, float c, float d) {
+	if (type < 0 || type >= kRoxyEaseCount) {
+		type = kRoxyEaseLinear;  // Fall back to linear for unknown identifiers
+	}
+	float result;
+	if (lutEnabled && roxy_ease_hasLUT(type) && evaluateLUT(type, t, b, c, d, ROXY_EASE_DEFAULT_ELASTIC_AMPLITUDE, ROXY_EASE_DEFAULT_ELASTIC_PERIOD, &result)) {
+		return result;
+	}
+	return roxy_ease_functions[type](t, b, c, d);
+}
+
+// Evaluates an easing by identifier with explicit elastic/back parameters
+float roxy_ease_evaluateWithParams(RoxyEaseType type, float t, float b, float c, float d, float p1, float p2) {
+	if (type < 0 || type >= kRoxyEaseCount) {
+		type = kRoxyEaseLinear;
+	}
+	float result;
+	if (lutEnabled && roxy_ease_hasLUT(type) && evaluateLUT(type, t, b, c, d, p1, p2, &result)) {
+		return result;
+	}
+	if (roxy_ease_param_functions[type] != NULL) {
+		return roxy_ease_param_functions[type](t, b, c, d, p1, p2);
+	}
+	return roxy_ease_functions[type](t, b, c, d);
+}
+
+// ! Lookup Table Diagnostics
+
+// Measures the lookup-table error of an easing against the exact curve over
+// ROXY_EASE_LUT_ERROR_SAMPLES points of a unit curve, reporting the maximum and mean absolute error
+void roxy_ease_getLUTError(RoxyEaseType type, float* outMaxError, float* outMeanError) {
+	*outMaxError = 0.0f;
+	*outMeanError = 0.0f;
+	if (type < 0 || type >= kRoxyEaseCount || !roxy_ease_hasLUT(type)) {
+		return;
+	}
+	
+	int wasEnabled = lutEnabled;
+	roxy_ease_setLUTEnabled(1);
+	
+	float total = 0.0f;
+	for (int i = 0; i <= ROXY_EASE_LUT_ERROR_SAMPLES; ++i) {
+		float t = (float)i / ROXY_EASE_LUT_ERROR_SAMPLES;
+		float approximate = roxy_ease_evaluate(type, t, 0.0f, 1.0f, 1.0f);
+		float exact = roxy_ease_functions[type](t, 0.0f, 1.0f, 1.0f);
+		float error = fabsf(approximate - exact);
+		if (error > *outMaxError) {
+			*outMaxError = error;
+		}
+		total += error;
+	}
+	*outMeanError = total / (ROXY_EASE_LUT_ERROR_SAMPLES + 1);
+	
+	roxy_ease_setLUTEnabled(wasEnabled);
+}
+
+// Times `iterations` evaluations of an easing with the exact and lookup-table paths, in seconds
+void roxy_ease_benchmarkLUT(RoxyEaseType type, int iterations, float* outExactTime, float* outLUTTime) {
+	static volatile float sink;  // Keeps the compiler from discarding the evaluated results
+	if (type < 0 || type >= kRoxyEaseCount || iterations <= 0) {
+		*outExactTime = 0.0f;
+		*outLUTTime = 0.0f;
+		return;
+	}
+	
+	int wasEnabled = lutEnabled;
+	float step = 1.0f / iterations;
+	
+	roxy_ease_setLUTEnabled(0);
+	float start = pd->system->getElapsedTime();
+	for (int i = 0; i < iterations; ++i) {
+		sink = roxy_ease_evaluate(type, i * step, 0.0f, 1.0f, 1.0f);
+	}
+	*outExactTime = pd->system->getElapsedTime() - start;
+	
+	roxy_ease_setLUTEnabled(1);
+	roxy_ease_evaluate(type, 0.0f, 0.0f, 1.0f, 1.0f);  // Touch the table once outside the timed loop
+	start = pd->system->getElapsedTime();
+	for (int i = 0; i < iterations; ++i) {
+		sink = roxy_ease_evaluate(type, i * step, 0.0f, 1.0f, 1.0f);
+	}
+	*outLUTTime = pd->system->getElapsedTime() - start;
+	(void)sink;
+	
+	roxy_ease_setLUTEnabled(wasEnabled);
+}
+
+// Lua wrapper for roxy_ease_setLUTEnabled
+int roxy_ease_setLUTEnabled_l(lua_State* L) {
+	(void)L;
+	
+	roxy_ease_setLUTEnabled(pd->lua->getArgBool(1));
+	return 0;
+}
+
+// Lua wrapper for roxy_ease_getLUTError. Returns the maximum and mean absolute error.
+int roxy_ease_getLUTError_l(lua_State* L) {
+	(void)L;
+	
+	float maxError, meanError;
+	roxy_ease_getLUTError((RoxyEaseType)pd->lua->getArgInt(1), &maxError, &meanError);
+	
+	pd->lua->pushFloat(maxError);
+	pd->lua->pushFloat(meanError);
+	return 2;
+}
+
+// Lua wrapper for roxy_ease_benchmarkLUT. Returns the exact and lookup-table times in seconds.
+int roxy_ease_benchmarkLUT_l(lua_State* L) {
+	(void)L;
+	
+	int iterations = (pd->lua->getArgCount() > 1) ? pd->lua->getArgInt(2) : 10000;
+	float exactTime, lutTime;
+	roxy_ease_benchmarkLUT((RoxyEaseType)pd->lua->getArgInt(1), iterations, &exactTime, &lutTime);
+	
+	pd->lua->pushFloat(exactTime);
+	pd->lua->pushFloat(lutTime);
+	return 2;
+}
+
+// ! Batch Sampling
+
+// Evaluates an easing at evenly spaced times, writing each result to `out`
+void roxy_ease_sampleBatch(RoxyEaseType type, float t0, float dt, int count, float b, float c, float d, float* out) {
+	if (type < 0 || type >= kRoxyEaseCount) {
+		type = kRoxyEaseLinear;  // Fall back to linear for unknown identifiers
+	}
+	
+	if (lutEnabled && roxy_ease_hasLUT(type)) {
+		for (int i = 0; i < count; ++i) {
+			out[i] = roxy_ease_evaluate(type, t0 + dt * i, b, c, d);
+		}
+		return;
+	}
+	
+	RoxyEaseFunction easeFunction = roxy_ease_functions[type];
+	for (int i = 0; i < count; ++i) {
+		out[i] = easeFunction(t0 + dt * i, b, c, d);
+	}
+}
+
+// Lua wrapper for roxy_ease_sampleBatch
+// Arguments: easeId, t0, dt, count, b, c, d. Returns `count` values.
+int roxy_ease_sampleBatch_l(lua_State* L) {
+	(void)L;
+	
+	int type = pd->lua->getArgInt(1);
+	float t0 = pd->lua->getArgFloat(2);
+	float dt = pd->lua->getArgFloat(3);
+	int count = pd->lua->getArgInt(4);
+	float b = pd->lua->getArgFloat(5);
+	float c = pd->lua->getArgFloat(6);
+	float d = pd->lua->getArgFloat(7);
+	
+	if (count <= 0) {
+		return 0;
+	}
+	if (count > ROXY_EASE_MAX_BATCH_SAMPLES) {
+		pd->system->logToConsole("Warning: sampleBatch count %d exceeds the maximum of %d.", count, ROXY_EASE_MAX_BATCH_SAMPLES);
+		count = ROXY_EASE_MAX_BATCH_SAMPLES;
+	}
+	
+	float results[ROXY_EASE_MAX_BATCH_SAMPLES];
+	roxy_ease_sampleBatch((RoxyEaseType)type, t0, dt, count, b, c, d, results);
+	
+	for (int i = 0; i < count; ++i) {
+		pd->lua->pushFloat(results[i]);
+	}
+	return count;
+}
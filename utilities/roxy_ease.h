@@ -33,6 +33,75 @@
 
 void roxy_easingFunctions_setPlaydateAPI(PlaydateAPI* playdate);
 
+// Easing identifiers, in the same order the easings are registered in roxy.c
+typedef enum {
+	kRoxyEaseFlat,
+	kRoxyEaseLinear,
+	kRoxyEaseInQuad,
+	kRoxyEaseOutQuad,
+	kRoxyEaseInOutQuad,
+	kRoxyEaseOutInQuad,
+	kRoxyEaseInCubic,
+	kRoxyEaseOutCubic,
+	kRoxyEaseInOutCubic,
+	kRoxyEaseOutInCubic,
+	kRoxyEaseInQuart,
+	kRoxyEaseOutQuart,
+	kRoxyEaseInOutQuart,
+	kRoxyEaseOutInQuart,
+	kRoxyEaseInQuint,
+	kRoxyEaseOutQuint,
+	kRoxyEaseInOutQuint,
+	kRoxyEaseOutInQuint,
+	kRoxyEaseInSine,
+	kRoxyEaseOutSine,
+	kRoxyEaseInOutSine,
+	kRoxyEaseOutInSine,
+	kRoxyEaseInExpo,
+	kRoxyEaseOutExpo,
+	kRoxyEaseInOutExpo,
+	kRoxyEaseOutInExpo,
+	kRoxyEaseInCirc,
+	kRoxyEaseOutCirc,
+	kRoxyEaseInOutCirc,
+	kRoxyEaseOutInCirc,
+	kRoxyEaseInElastic,
+	kRoxyEaseOutElastic,
+	kRoxyEaseInOutElastic,
+	kRoxyEaseOutInElastic,
+	kRoxyEaseInBack,
+	kRoxyEaseOutBack,
+	kRoxyEaseInOutBack,
+	kRoxyEaseOutInBack,
+	kRoxyEaseOutBounce,
+	kRoxyEaseInBounce,
+	kRoxyEaseInOutBounce,
+	kRoxyEaseOutInBounce,
+	kRoxyEaseCount
+} RoxyEaseType;
+
+// Maximum number of samples returned to Lua by a single sampleBatch call, within the
+// LUA_MINSTACK (20) slots a C function is guaranteed
+#define ROXY_EASE_MAX_BATCH_SAMPLES 16
+
+// Default parameters used when elastic and back easings are called without them. As in the SDK's easings,
+// an amplitude of 0 matches the change, and a period of 0 is relative to the duration: 0.3 * d, or 0.45 * d
+// for InOutElastic.
+#define ROXY_EASE_DEFAULT_ELASTIC_AMPLITUDE 0.0f
+#define ROXY_EASE_DEFAULT_ELASTIC_PERIOD 0.0f
+#define ROXY_EASE_DEFAULT_BACK_OVERSHOOT 1.70158f
+
+// Lookup-table resolution (entries per curve)
+#ifndef ROXY_EASE_LUT_SIZE
+#define ROXY_EASE_LUT_SIZE 256
+#endif
+#define ROXY_EASE_LUT_ERROR_SAMPLES 4096
+
+typedef float (*RoxyEaseFunction)(float t, float b, float c, float d);
+
+// Parameterized easing: p1/p2 are amplitude/period for elastic easings, p1 is overshoot for back easings
+typedef float (*RoxyEaseParamFunction)(float t, float b, float c, float d, float p1, float p2);
+
 // Easing function prototypes
 
 // Linear easing, no acceleration or deceleration
@@ -99,6 +168,40 @@ float roxy_ease_in_bounce(float t, float b, float c, float d);
 float roxy_ease_in_out_bounce(float t, float b, float c, float d);
 float roxy_ease_out_in_bounce(float t, float b, float c, float d);
 
+// Dispatch tables
+
+// Easing functions indexed by RoxyEaseType; elastic and back easings use their default parameters
+extern const RoxyEaseFunction roxy_ease_functions[kRoxyEaseCount];
+
+// Parameterized variants indexed by RoxyEaseType; NULL for easings that take no parameters
+extern const RoxyEaseParamFunction roxy_ease_param_functions[kRoxyEaseCount];
+
+// Evaluates an easing by identifier, falling back to linear for unknown identifiers
+float roxy_ease_evaluate(RoxyEaseType type, float t, float b, float c, float d);
+
+// Evaluates an easing by identifier with explicit elastic/back parameters (ignored by other easings)
+float roxy_ease_evaluateWithParams(RoxyEaseType type, float t, float b, float c, float d, float p1, float p2);
+
+// Lookup tables (opt-in)
+
+// Enables or disables lookup-table evaluation for the sine, expo, circ and elastic easings
+void roxy_ease_setLUTEnabled(int enabled);
+int roxy_ease_isLUTEnabled(void);
+
+// Returns whether an easing is backed by a lookup table when they are enabled
+int roxy_ease_hasLUT(RoxyEaseType type);
+
+// Reports the maximum and mean absolute error of an easing's lookup table on a unit curve
+void roxy_ease_getLUTError(RoxyEaseType type, float* outMaxError, float* outMeanError);
+
+// Times the exact and lookup-table paths of an easing over `iterations` evaluations, in seconds
+void roxy_ease_benchmarkLUT(RoxyEaseType type, int iterations, float* outExactTime, float* outLUTTime);
+
+// Batch sampling
+
+// Evaluates an easing `count` times, starting at t0 and stepping by dt, writing the results to `out`
+void roxy_ease_sampleBatch(RoxyEaseType type, float t0, float dt, int count, float b, float c, float d, float* out);
+
 // Lua wrapper function prototypes
 // (Wrappers for the easing functions, for use within the Lua environment)
 int roxy_ease_flat_l(lua_State* L);
@@ -143,5 +246,9 @@ int roxy_ease_out_bounce_l(lua_State* L);
 int roxy_ease_in_bounce_l(lua_State* L);
 int roxy_ease_in_out_bounce_l(lua_State* L);
 int roxy_ease_out_in_bounce_l(lua_State* L);
+int roxy_ease_sampleBatch_l(lua_State* L);
+int roxy_ease_setLUTEnabled_l(lua_State* L);
+int roxy_ease_getLUTError_l(lua_State* L);
+int roxy_ease_benchmarkLUT_l(lua_State* L);
 
 #endif /* ROXY_EASE_H */
@@ -0,0 +1,374 @@
+#include "roxy_graphics.h"
+#include <stdint.h>
+#include <string.h>
+
+#define LCD_ROWWORDS (LCD_ROWSIZE / 4)
+
+static PlaydateAPI* pd = NULL;
+
+// Dither thresholds from 0 to 63; a pixel is shown at levels above its threshold
+static const uint8_t bayer8x8[8][8] = {
+	{  0, 32,  8, 40,  2, 34, 10, 42 },
+	{ 48, 16, 56, 24, 50, 18, 58, 26 },
+	{ 12, 44,  4, 36, 14, 46,  6, 38 },
+	{ 60, 28, 52, 20, 62, 30, 54, 22 },
+	{  3, 35, 11, 43,  1, 33,  9, 41 },
+	{ 51, 19, 59, 27, 49, 17, 57, 25 },
+	{ 15, 47,  7, 39, 13, 45,  5, 37 },
+	{ 63, 31, 55, 23, 61, 29, 53, 21 }
+};
+
+static const uint8_t bayer4x4[4][4] = {
+	{  0,  8,  2, 10 },
+	{ 12,  4, 14,  6 },
+	{  3, 11,  1,  9 },
+	{ 15,  7, 13,  5 }
+};
+
+// Generated with void-and-cluster on a wrapping 8x8 grid
+static const uint8_t blueNoise8x8[8][8] = {
+	{ 53, 28, 61, 37, 20, 44, 25,  9 },
+	{  4, 42, 16,  5, 58,  8, 51, 32 },
+	{ 13, 55, 30, 47, 24, 35, 17, 60 },
+	{ 38, 22,  0, 39, 52,  3, 43, 27 },
+	{  7, 48, 62, 12, 19, 59, 11, 50 },
+	{ 31, 15, 34, 26, 45, 33, 23, 54 },
+	{  2, 57, 40,  6, 56,  1, 41, 18 },
+	{ 46, 21, 10, 49, 29, 14, 63, 36 }
+};
+
+// Row masks of every level of every dither type, built once
+static uint8_t ditherMasks[ROXY_GRAPHICS_DITHER_COUNT][ROXY_GRAPHICS_DITHER_LEVELS + 1][8];
+
+static int getThreshold(RoxyDitherType ditherType, int row, int column) {
+	switch (ditherType) {
+		case kRoxyDitherBayer4x4:
+			return bayer4x4[row & 3][column & 3] * 4;  // Spread over the 64 levels
+		case kRoxyDitherBlueNoise:
+			return blueNoise8x8[row][column];
+		default:
+			return bayer8x8[row][column];
+	}
+}
+
+static void buildDitherMasks(void) {
+	for (int type = 0; type < ROXY_GRAPHICS_DITHER_COUNT; ++type) {
+		for (int level = 0; level <= ROXY_GRAPHICS_DITHER_LEVELS; ++level) {
+			for (int row = 0; row < 8; ++row) {
+				uint8_t mask = 0;
+				for (int column = 0; column < 8; ++column) {
+					if (getThreshold((RoxyDitherType)(type + 1), row, column) < level) {
+						mask |= (uint8_t)(0x80 >> column);  // The leftmost pixel is the high bit
+					}
+				}
+				ditherMasks[type][level][row] = mask;
+			}
+		}
+	}
+}
+
+// Dither constants for Lua
+static const lua_reg noFunctions[] = { { NULL, NULL } };
+static const lua_val graphicsConstants[] = {
+	{ "DITHER_BAYER8X8", kInt, { .intval = kRoxyDitherBayer8x8 } },
+	{ "DITHER_BAYER4X4", kInt, { .intval = kRoxyDitherBayer4x4 } },
+	{ "DITHER_BLUE_NOISE", kInt, { .intval = kRoxyDitherBlueNoise } },
+	{ "DITHER_LEVELS", kInt, { .intval = ROXY_GRAPHICS_DITHER_LEVELS } },
+	{ NULL, kInt, { .intval = 0 } }
+};
+
+void roxy_graphics_setPlaydateAPI(PlaydateAPI* playdate) {
+	pd = playdate;
+	buildDitherMasks();
+}
+
+int roxy_graphics_registerConstants(const char** outErr) {
+	return pd->lua->registerClass("roxy.graphics", noFunctions, graphicsConstants, 1, outErr);
+}
+
+// ! Frame Capture
+
+int roxy_graphics_copyFrameToBitmap(const uint8_t* frame, LCDBitmap* bitmap, int startRow, int endRow) {
+	if (frame == NULL || bitmap == NULL) {
+		return 0;
+	}
+	
+	int width, height, rowBytes;
+	uint8_t* mask = NULL;
+	uint8_t* data = NULL;
+	pd->graphics->getBitmapData(bitmap, &width, &height, &rowBytes, &mask, &data);
+	if (data == NULL) {
+		return 0;
+	}
+	
+	if (startRow < 0) {
+		startRow = 0;
+	}
+	if (endRow > height) {
+		endRow = height;
+	}
+	if (endRow > LCD_ROWS) {
+		endRow = LCD_ROWS;
+	}
+	if (startRow >= endRow) {
+		return 0;
+	}
+	
+	// Rows are copied whole; a bitmap narrower than the display only gets its own columns
+	int copyBytes = rowBytes < LCD_ROWSIZE ? rowBytes : LCD_ROWSIZE;
+	if (rowBytes == LCD_ROWSIZE) {
+		memcpy(data + startRow * rowBytes, frame + startRow * LCD_ROWSIZE, (size_t)(endRow - startRow) * LCD_ROWSIZE);
+	} else {
+		for (int row = startRow; row < endRow; ++row) {
+			memcpy(data + row * rowBytes, frame + row * LCD_ROWSIZE, (size_t)copyBytes);
+		}
+	}
+	
+	if (mask != NULL) {
+		memset(mask + startRow * rowBytes, 0xFF, (size_t)(endRow - startRow) * rowBytes);
+	}
+	return 1;
+}
+
+int roxy_graphics_captureFrame(LCDBitmap* bitmap) {
+	return roxy_graphics_copyFrameToBitmap(pd->graphics->getFrame(), bitmap, 0, LCD_ROWS);
+}
+
+int roxy_graphics_captureDisplay(LCDBitmap* bitmap) {
+	return roxy_graphics_copyFrameToBitmap(pd->graphics->getDisplayFrame(), bitmap, 0, LCD_ROWS);
+}
+
+// ! Dithered Fades
+
+int roxy_graphics_getDitherLevel(float alpha) {
+	if (!(alpha > 0.0f)) {
+		return 0;  // Also catches NaN
+	}
+	if (alpha >= 1.0f) {
+		return ROXY_GRAPHICS_DITHER_LEVELS;
+	}
+	return (int)(alpha * ROXY_GRAPHICS_DITHER_LEVELS + 0.5f);
+}
+
+const uint8_t* roxy_graphics_getDitherMask(RoxyDitherType ditherType, int level) {
+	if (ditherType < kRoxyDitherBayer8x8 || ditherType > ROXY_GRAPHICS_DITHER_COUNT) {
+		ditherType = kRoxyDitherBayer8x8;
+	}
+	if (level < 0) {
+		level = 0;
+	} else if (level > ROXY_GRAPHICS_DITHER_LEVELS) {
+		level = ROXY_GRAPHICS_DITHER_LEVELS;
+	}
+	return ditherMasks[ditherType - 1][level];
+}
+
+// Blends one row 32 bits at a time, taking the source's bits where the mask is set. Returns whether the row changed.
+static int dissolveRowWords(uint32_t* destination, const uint32_t* source, const uint32_t* sourceMask, uint32_t mask) {
+	uint32_t changed = 0;
+	for (int word = 0; word < LCD_ROWWORDS; ++word) {
+		uint32_t wordMask = sourceMask != NULL ? mask & sourceMask[word] : mask;
+		uint32_t value = destination[word];
+		uint32_t blended = value ^ ((value ^ source[word]) & wordMask);
+		changed |= blended ^ value;
+		destination[word] = blended;
+	}
+	return changed != 0;
+}
+
+// Same as dissolveRowWords, a byte at a time, for rows that aren't word-aligned
+static int dissolveRowBytes(uint8_t* destination, const uint8_t* source, const uint8_t* sourceMask, uint8_t mask, int byteCount) {
+	uint8_t changed = 0;
+	for (int i = 0; i < byteCount; ++i) {
+		uint8_t byteMask = sourceMask != NULL ? mask & sourceMask[i] : mask;
+		uint8_t value = destination[i];
+		uint8_t blended = value ^ ((value ^ source[i]) & byteMask);
+		changed |= blended ^ value;
+		destination[i] = blended;
+	}
+	return changed != 0;
+}
+
+// Marks a run of changed rows, from runStart up to the row before `row`, and returns -1 to start a new run
+static int markRun(int runStart, int row) {
+	if (runStart >= 0) {
+		pd->graphics->markUpdatedRows(runStart, row - 1);
+	}
+	return -1;
+}
+
+int roxy_graphics_dissolve(LCDBitmap* bitmap, float alpha, RoxyDitherType ditherType) {
+	int level = roxy_graphics_getDitherLevel(alpha);
+	if (bitmap == NULL || level == 0) {
+		return 0;
+	}
+	
+	int width, height, rowBytes;
+	uint8_t* bitmapMask = NULL;
+	uint8_t* data = NULL;
+	pd->graphics->getBitmapData(bitmap, &width, &height, &rowBytes, &bitmapMask, &data);
+	uint8_t* frame = pd->graphics->getFrame();
+	if (data == NULL || frame == NULL) {
+		return 0;
+	}
+	
+	const uint8_t* ditherMask = roxy_graphics_getDitherMask(ditherType, level);
+	int rowCount = height < LCD_ROWS ? height : LCD_ROWS;
+	int byteCount = rowBytes < LCD_ROWSIZE ? rowBytes : LCD_ROWSIZE;
+	int useWords = rowBytes == LCD_ROWSIZE
+		&& ((uintptr_t)frame & 3) == 0
+		&& ((uintptr_t)data & 3) == 0
+		&& (bitmapMask == NULL || ((uintptr_t)bitmapMask & 3) == 0);
+	
+	int changedRows = 0;
+	int runStart = -1;  // First row of the current run of changed rows, marked together
+	for (int row = 0; row < rowCount; ++row) {
+		uint8_t rowMask = ditherMask[row & 7];
+		int changed = 0;
+		if (rowMask != 0) {
+			uint8_t* destination = frame + row * LCD_ROWSIZE;
+			const uint8_t* source = data + row * rowBytes;
+			const uint8_t* sourceMask = bitmapMask != NULL ? bitmapMask + row * rowBytes : NULL;
+			if (useWords) {
+				changed = dissolveRowWords((uint32_t*)destination, (const uint32_t*)source, (const uint32_t*)sourceMask, rowMask * 0x01010101u);
+			} else {
+				changed = dissolveRowBytes(destination, source, sourceMask, rowMask, byteCount);
+			}
+		}
+		
+		if (changed) {
+			changedRows++;
+			if (runStart < 0) {
+				runStart = row;
+			}
+		} else {
+			runStart = markRun(runStart, row);
+		}
+	}
+	markRun(runStart, rowCount);
+	return changedRows;
+}
+
+int roxy_graphics_fillDithered(int x, int y, int width, int height, LCDSolidColor color, float alpha, RoxyDitherType ditherType) {
+	int level = roxy_graphics_getDitherLevel(alpha);
+	if (level == 0 || color == kColorClear) {
+		return 0;
+	}
+	
+	uint8_t* frame = pd->graphics->getFrame();
+	if (frame == NULL) {
+		return 0;
+	}
+	
+	// Clip to the display; the dither stays aligned to the unclipped corner
+	int startColumn = x > 0 ? x : 0;
+	int endColumn = x + width < LCD_COLUMNS ? x + width : LCD_COLUMNS;
+	int startRow = y > 0 ? y : 0;
+	int endRow = y + height < LCD_ROWS ? y + height : LCD_ROWS;
+	if (startColumn >= endColumn || startRow >= endRow) {
+		return 0;
+	}
+	
+	// Columns covered by the rectangle, as a row of bits, read 32 bits at a time
+	uint32_t spanWords[LCD_ROWWORDS];
+	uint8_t* span = (uint8_t*)spanWords;
+	memset(span, 0, LCD_ROWSIZE);
+	for (int byte = startColumn / 8; byte <= (endColumn - 1) / 8; ++byte) {
+		uint8_t bits = 0xFF;
+		if (byte == startColumn / 8) {
+			bits &= (uint8_t)(0xFF >> (startColumn & 7));
+		}
+		if (byte == (endColumn - 1) / 8) {
+			bits &= (uint8_t)(0xFF << (7 - ((endColumn - 1) & 7)));
+		}
+		span[byte] = bits;
+	}
+	int firstWord = (startColumn / 8) / 4;
+	int lastWord = ((endColumn - 1) / 8) / 4;
+	
+	const uint8_t* ditherMask = roxy_graphics_getDitherMask(ditherType, level);
+	int shift = ((x % 8) + 8) % 8;  // Rotates the mask so its first column lines up with x
+	int useWords = ((uintptr_t)frame & 3) == 0;
+	
+	int changedRows = 0;
+	int runStart = -1;
+	for (int row = startRow; row < endRow; ++row) {
+		uint8_t rowMask = ditherMask[((row - y) % 8 + 8) % 8];
+		rowMask = (uint8_t)((rowMask >> shift) | (rowMask << ((8 - shift) & 7)));
+		uint32_t pattern = rowMask * 0x01010101u;
+		uint32_t changed = 0;
+		
+		if (pattern != 0) {
+			uint8_t* destination = frame + row * LCD_ROWSIZE;
+			for (int word = firstWord; word <= lastWord; ++word) {
+				uint32_t mask = pattern & spanWords[word];
+				uint32_t value;
+				if (useWords) {
+					value = ((uint32_t*)destination)[word];
+				} else {
+					memcpy(&value, destination + word * 4, 4);
+				}
+				
+				uint32_t filled;
+				if (color == kColorWhite) {
+					filled = value | mask;
+				} else if (color == kColorBlack) {
+					filled = value & ~mask;
+				} else {
+					filled = value ^ mask;
+				}
+				
+				changed |= filled ^ value;
+				if (useWords) {
+					((uint32_t*)destination)[word] = filled;
+				} else {
+					memcpy(destination + word * 4, &filled, 4);
+				}
+			}
+		}
+		
+		if (changed != 0) {
+			changedRows++;
+			if (runStart < 0) {
+				runStart = row;
+			}
+		} else {
+			runStart = markRun(runStart, row);
+		}
+	}
+	markRun(runStart, endRow);
+	return changedRows;
+}
+
+// ! Lua Bindings
+
+int roxy_graphics_captureFrame_l(lua_State* L) {
+	LCDBitmap* bitmap = pd->lua->getArgObject(1, "playdate.graphics.image", NULL);
+	pd->lua->pushBool(roxy_graphics_captureFrame(bitmap));
+	return 1;
+}
+
+int roxy_graphics_captureDisplay_l(lua_State* L) {
+	LCDBitmap* bitmap = pd->lua->getArgObject(1, "playdate.graphics.image", NULL);
+	pd->lua->pushBool(roxy_graphics_captureDisplay(bitmap));
+	return 1;
+}
+
+int roxy_graphics_dissolve_l(lua_State* L) {
+	LCDBitmap* bitmap = pd->lua->getArgObject(1, "playdate.graphics.image", NULL);
+	float alpha = pd->lua->getArgFloat(2);
+	RoxyDitherType ditherType = pd->lua->argIsNil(3) ? kRoxyDitherBayer8x8 : (RoxyDitherType)pd->lua->getArgInt(3);
+	pd->lua->pushInt(roxy_graphics_dissolve(bitmap, alpha, ditherType));
+	return 1;
+}
+
+int roxy_graphics_fillDithered_l(lua_State* L) {
+	int x = pd->lua->getArgInt(1);
+	int y = pd->lua->getArgInt(2);
+	int width = pd->lua->getArgInt(3);
+	int height = pd->lua->getArgInt(4);
+	LCDSolidColor color = (LCDSolidColor)pd->lua->getArgInt(5);
+	float alpha = pd->lua->getArgFloat(6);
+	RoxyDitherType ditherType = pd->lua->argIsNil(7) ? kRoxyDitherBayer8x8 : (RoxyDitherType)pd->lua->getArgInt(7);
+	pd->lua->pushInt(roxy_graphics_fillDithered(x, y, width, height, color, alpha, ditherType));
+	return 1;
+}
@@ -0,0 +1,58 @@
+#ifndef ROXY_GRAPHICS_H
+#define ROXY_GRAPHICS_H
+
+#include "pd_api.h"
+
+#define ROXY_GRAPHICS_DITHER_LEVELS 64  // Fade levels of an 8x8 dither matrix, plus fully opaque
+
+// Dither matrices for native fades, by id
+typedef enum {
+	kRoxyDitherBayer8x8 = 1,
+	kRoxyDitherBayer4x4,
+	kRoxyDitherBlueNoise
+} RoxyDitherType;
+
+#define ROXY_GRAPHICS_DITHER_COUNT 3
+
+void roxy_graphics_setPlaydateAPI(PlaydateAPI* playdate);
+
+// Registers the dither ids in the roxy.graphics table
+int roxy_graphics_registerConstants(const char** outErr);
+
+// ! Frame Capture
+// Copies rows [startRow, endRow) of a 1-bit frame buffer, LCD_ROWSIZE bytes per row, into a bitmap of the display's size.
+// Rows outside the bitmap are skipped; a mask, if any, is made opaque over the copied rows. Returns 0 if nothing was copied.
+int roxy_graphics_copyFrameToBitmap(const uint8_t* frame, LCDBitmap* bitmap, int startRow, int endRow);
+
+// Copies the frame being drawn, or the last frame sent to the display, into a bitmap
+int roxy_graphics_captureFrame(LCDBitmap* bitmap);
+int roxy_graphics_captureDisplay(LCDBitmap* bitmap);
+
+// ! Dithered Fades
+// Returns the level, from 0 to ROXY_GRAPHICS_DITHER_LEVELS, closest to an alpha from 0 to 1
+int roxy_graphics_getDitherLevel(float alpha);
+
+// Returns the 8x8 mask of a dither level, one byte per row, with a bit set for each pixel shown at that level.
+// Unknown dither types fall back to Bayer 8x8.
+const uint8_t* roxy_graphics_getDitherMask(RoxyDitherType ditherType, int level);
+
+// Cross-dissolves a display-sized bitmap over the frame being drawn, showing the bitmap's pixels where the
+// dither mask of `alpha` is set. Only rows that change are marked for the display. Returns the number of changed rows.
+int roxy_graphics_dissolve(LCDBitmap* bitmap, float alpha, RoxyDitherType ditherType);
+
+// Fills a rectangle of the frame being drawn with a solid color faded by `alpha`, using the cached dither mask
+// of its level, aligned to the rectangle's top left corner. Black, white and XOR are supported; clear draws nothing.
+// This is what drawFaded draws for a solid panel. Only rows that change are marked. Returns the number of changed rows.
+int roxy_graphics_fillDithered(int x, int y, int width, int height, LCDSolidColor color, float alpha, RoxyDitherType ditherType);
+
+// Lua bindings
+// roxy.graphics.captureFrame(image) -> success
+int roxy_graphics_captureFrame_l(lua_State* L);
+// roxy.graphics.captureDisplay(image) -> success
+int roxy_graphics_captureDisplay_l(lua_State* L);
+// roxy.graphics.dissolve(image, alpha, [ditherType]) -> changedRows
+int roxy_graphics_dissolve_l(lua_State* L);
+// roxy.graphics.fillDithered(x, y, width, height, color, alpha, [ditherType]) -> changedRows
+int roxy_graphics_fillDithered_l(lua_State* L);
+
+#endif /* ROXY_GRAPHICS_H */
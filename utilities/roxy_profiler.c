@@ -0,0 +1,337 @@
+#include "roxy_profiler.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define MAX_ZONE_NAME 24
+#define OVERLAY_LINE_HEIGHT 16
+#define OVERLAY_WIDTH 200
+
+static PlaydateAPI* pd = NULL;
+
+typedef struct {
+	char name[MAX_ZONE_NAME];
+	float start;  // Elapsed time the zone was entered, or a negative value while outside it
+	float frameTime;  // Time spent in the zone this frame, in seconds
+} RoxyProfilerZone;
+
+static int isEnabled = 0;
+static RoxyProfilerZone zones[ROXY_PROFILER_MAX_ZONES];
+static int zoneCount = 0;
+static int currentPhase = -1;
+
+// Frame times of each zone, one ring buffer of `frameCapacity` samples per zone
+static float* samples = NULL;
+static float* sortedSamples = NULL;  // Scratch space for percentiles
+static int frameCapacity = 0;
+static int frameCount = 0;  // Frames recorded, up to frameCapacity
+static int frameIndex = 0;  // Next slot to write in each ring buffer
+
+void roxy_profiler_setPlaydateAPI(PlaydateAPI* playdate) {
+	pd = playdate;
+	
+	if (zoneCount == 0) {
+		roxy_profiler_registerZone("frame");  // ROXY_PROFILER_FRAME_ZONE
+	}
+}
+
+int roxy_profiler_setEnabled(int enabled, int newFrameCapacity) {
+	isEnabled = 0;
+	if (!enabled) {
+		return 1;
+	}
+	
+	if (newFrameCapacity <= 0) {
+		newFrameCapacity = ROXY_PROFILER_DEFAULT_FRAMES;
+	}
+	if (newFrameCapacity != frameCapacity) {
+		float* newSamples = pd->system->realloc(samples, sizeof(float) * newFrameCapacity * ROXY_PROFILER_MAX_ZONES);
+		float* newSortedSamples = pd->system->realloc(sortedSamples, sizeof(float) * newFrameCapacity);
+		if (newSamples != NULL) {
+			samples = newSamples;
+		}
+		if (newSortedSamples != NULL) {
+			sortedSamples = newSortedSamples;
+		}
+		if (newSamples == NULL || newSortedSamples == NULL) {
+			// Drop both buffers so their sizes can't disagree with frameCapacity
+			samples = pd->system->realloc(samples, 0);
+			sortedSamples = pd->system->realloc(sortedSamples, 0);
+			frameCapacity = 0;
+			pd->system->logToConsole("Warning: Failed to allocate profiler frames.");
+			return 0;
+		}
+		frameCapacity = newFrameCapacity;
+	}
+	
+	roxy_profiler_reset();
+	isEnabled = 1;
+	return 1;
+}
+
+int roxy_profiler_isEnabled(void) {
+	return isEnabled;
+}
+
+int roxy_profiler_registerZone(const char* name) {
+	for (int i = 0; i < zoneCount; ++i) {
+		if (strncmp(zones[i].name, name, MAX_ZONE_NAME - 1) == 0) {
+			return i;
+		}
+	}
+	if (zoneCount == ROXY_PROFILER_MAX_ZONES) {
+		pd->system->logToConsole("Warning: Can't register more than %d profiler zones.", ROXY_PROFILER_MAX_ZONES);
+		return -1;
+	}
+	
+	RoxyProfilerZone* zone = &zones[zoneCount];
+	strncpy(zone->name, name, MAX_ZONE_NAME - 1);
+	zone->name[MAX_ZONE_NAME - 1] = '\0';
+	zone->start = -1.0f;
+	zone->frameTime = 0.0f;
+	
+	// A zone registered mid-run starts with empty frames
+	if (samples != NULL) {
+		memset(samples + zoneCount * frameCapacity, 0, sizeof(float) * frameCapacity);
+	}
+	return zoneCount++;
+}
+
+// ! Markers
+
+void roxy_profiler_beginFrame(void) {
+	if (!isEnabled) {
+		return;
+	}
+	for (int i = 0; i < zoneCount; ++i) {
+		zones[i].frameTime = 0.0f;
+		zones[i].start = -1.0f;
+	}
+	currentPhase = -1;
+	zones[ROXY_PROFILER_FRAME_ZONE].start = pd->system->getElapsedTime();
+}
+
+void roxy_profiler_beginZone(int zone) {
+	if (!isEnabled || zone < 0 || zone >= zoneCount) {
+		return;
+	}
+	zones[zone].start = pd->system->getElapsedTime();
+}
+
+void roxy_profiler_endZone(int zone) {
+	if (!isEnabled || zone < 0 || zone >= zoneCount || zones[zone].start < 0.0f) {
+		return;
+	}
+	zones[zone].frameTime += pd->system->getElapsedTime() - zones[zone].start;
+	zones[zone].start = -1.0f;
+}
+
+void roxy_profiler_phase(int zone) {
+	if (!isEnabled) {
+		return;
+	}
+	roxy_profiler_endZone(currentPhase);
+	currentPhase = zone;
+	roxy_profiler_beginZone(zone);
+}
+
+void roxy_profiler_endFrame(void) {
+	if (!isEnabled) {
+		return;
+	}
+	roxy_profiler_endZone(currentPhase);
+	currentPhase = -1;
+	roxy_profiler_endZone(ROXY_PROFILER_FRAME_ZONE);
+	
+	for (int i = 0; i < zoneCount; ++i) {
+		samples[i * frameCapacity + frameIndex] = zones[i].frameTime;
+	}
+	frameIndex = (frameIndex + 1) % frameCapacity;
+	if (frameCount < frameCapacity) {
+		++frameCount;
+	}
+}
+
+// ! Stats
+
+static int compareFloats(const void* a, const void* b) {
+	float x = *(const float*)a;
+	float y = *(const float*)b;
+	return (x > y) - (x < y);
+}
+
+int roxy_profiler_getStats(int zone, float* outMin, float* outAverage, float* outMax, float* outP99) {
+	if (zone < 0 || zone >= zoneCount || frameCount == 0) {
+		return 0;
+	}
+	
+	// The ring buffer is only full of valid frames once it has wrapped, but its order doesn't matter here
+	const float* zoneSamples = samples + zone * frameCapacity;
+	float total = 0.0f;
+	for (int i = 0; i < frameCount; ++i) {
+		sortedSamples[i] = zoneSamples[i];
+		total += zoneSamples[i];
+	}
+	qsort(sortedSamples, frameCount, sizeof(float), compareFloats);
+	
+	int p99Index = (frameCount * 99 + 99) / 100 - 1;  // Nearest rank
+	*outMin = sortedSamples[0] * 1000.0f;
+	*outAverage = total / frameCount * 1000.0f;
+	*outMax = sortedSamples[frameCount - 1] * 1000.0f;
+	*outP99 = sortedSamples[p99Index] * 1000.0f;
+	return 1;
+}
+
+void roxy_profiler_drawOverlay(int x, int y) {
+	if (!isEnabled) {
+		return;
+	}
+	
+	pd->graphics->fillRect(x, y, OVERLAY_WIDTH, OVERLAY_LINE_HEIGHT * (zoneCount + 1), kColorWhite);
+	
+	char line[64];
+	int length = snprintf(line, sizeof(line), "ms      avg   max   p99");
+	pd->graphics->drawText(line, length, kASCIIEncoding, x + 2, y);
+	
+	for (int i = 0; i < zoneCount; ++i) {
+		float min, average, max, p99;
+		if (!roxy_profiler_getStats(i, &min, &average, &max, &p99)) {
+			continue;
+		}
+		length = snprintf(line, sizeof(line), "%-7.7s %5.1f %5.1f %5.1f", zones[i].name, (double)average, (double)max, (double)p99);
+		pd->graphics->drawText(line, length, kASCIIEncoding, x + 2, y + OVERLAY_LINE_HEIGHT * (i + 1));
+	}
+}
+
+int roxy_profiler_dump(const char* path) {
+	SDFile* file = pd->file->open(path, kFileWrite);
+	if (file == NULL) {
+		pd->system->logToConsole("Warning: Failed to open %s for writing, %s", path, pd->file->geterr());
+		return 0;
+	}
+	
+	char line[96];
+	int length = snprintf(line, sizeof(line), "zone,frames,min_ms,avg_ms,max_ms,p99_ms\n");
+	int success = pd->file->write(file, line, length) == length;
+	for (int i = 0; i < zoneCount && success; ++i) {
+		float min = 0.0f, average = 0.0f, max = 0.0f, p99 = 0.0f;
+		roxy_profiler_getStats(i, &min, &average, &max, &p99);
+		length = snprintf(line, sizeof(line), "%s,%d,%.3f,%.3f,%.3f,%.3f\n", zones[i].name, frameCount, (double)min, (double)average, (double)max, (double)p99);
+		success = pd->file->write(file, line, length) == length;
+	}
+	pd->file->close(file);
+	
+	if (!success) {
+		pd->system->logToConsole("Warning: Failed to write profiler stats to %s.", path);
+	}
+	return success;
+}
+
+void roxy_profiler_reset(void) {
+	frameCount = 0;
+	frameIndex = 0;
+	currentPhase = -1;
+}
+
+// ! Lua Bindings
+
+// roxy.profiler.setEnabled(enabled, [frameCount]) -> success
+int roxy_profiler_setEnabled_l(lua_State* L) {
+	(void)L;
+	
+	int frames = pd->lua->argIsNil(2) ? 0 : pd->lua->getArgInt(2);
+	pd->lua->pushBool(roxy_profiler_setEnabled(pd->lua->getArgBool(1), frames));
+	return 1;
+}
+
+int roxy_profiler_isEnabled_l(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushBool(isEnabled);
+	return 1;
+}
+
+// roxy.profiler.registerZone(name) -> zone, or nil if there are too many zones
+int roxy_profiler_registerZone_l(lua_State* L) {
+	(void)L;
+	
+	int zone = roxy_profiler_registerZone(pd->lua->getArgString(1));
+	if (zone < 0) {
+		pd->lua->pushNil();
+	} else {
+		pd->lua->pushInt(zone);
+	}
+	return 1;
+}
+
+int roxy_profiler_beginFrame_l(lua_State* L) {
+	(void)L;
+	
+	roxy_profiler_beginFrame();
+	return 0;
+}
+
+int roxy_profiler_phase_l(lua_State* L) {
+	(void)L;
+	
+	roxy_profiler_phase(pd->lua->getArgInt(1));
+	return 0;
+}
+
+int roxy_profiler_beginZone_l(lua_State* L) {
+	(void)L;
+	
+	roxy_profiler_beginZone(pd->lua->getArgInt(1));
+	return 0;
+}
+
+int roxy_profiler_endZone_l(lua_State* L) {
+	(void)L;
+	
+	roxy_profiler_endZone(pd->lua->getArgInt(1));
+	return 0;
+}
+
+int roxy_profiler_endFrame_l(lua_State* L) {
+	(void)L;
+	
+	roxy_profiler_endFrame();
+	return 0;
+}
+
+int roxy_profiler_getStats_l(lua_State* L) {
+	(void)L;
+	
+	float min, average, max, p99;
+	if (!roxy_profiler_getStats(pd->lua->getArgInt(1), &min, &average, &max, &p99)) {
+		pd->lua->pushNil();
+		return 1;
+	}
+	pd->lua->pushFloat(min);
+	pd->lua->pushFloat(average);
+	pd->lua->pushFloat(max);
+	pd->lua->pushFloat(p99);
+	return 4;
+}
+
+int roxy_profiler_drawOverlay_l(lua_State* L) {
+	(void)L;
+	
+	int x = pd->lua->argIsNil(1) ? 0 : pd->lua->getArgInt(1);
+	int y = pd->lua->argIsNil(2) ? 0 : pd->lua->getArgInt(2);
+	roxy_profiler_drawOverlay(x, y);
+	return 0;
+}
+
+int roxy_profiler_dump_l(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushBool(roxy_profiler_dump(pd->lua->getArgString(1)));
+	return 1;
+}
+
+int roxy_profiler_reset_l(lua_State* L) {
+	(void)L;
+	
+	roxy_profiler_reset();
+	return 0;
+}
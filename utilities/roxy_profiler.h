@@ -0,0 +1,65 @@
+#ifndef ROXY_PROFILER_H
+#define ROXY_PROFILER_H
+
+#include "pd_api.h"
+
+#define ROXY_PROFILER_MAX_ZONES 32
+#define ROXY_PROFILER_DEFAULT_FRAMES 120
+#define ROXY_PROFILER_FRAME_ZONE 0  // Zone id of the whole frame, from beginFrame to endFrame
+
+void roxy_profiler_setPlaydateAPI(PlaydateAPI* playdate);
+
+// Turns profiling on or off and sets the number of frames kept per zone. Turning it on clears the recorded frames.
+// While off, every marker returns right away.
+int roxy_profiler_setEnabled(int enabled, int frameCount);
+int roxy_profiler_isEnabled(void);
+
+// Registers a named zone and returns its id, or the existing id if the name is already registered.
+// Returns -1 if there are too many zones.
+int roxy_profiler_registerZone(const char* name);
+
+// ! Markers
+// Times are read from the system's elapsed time, which roxy_time resets at the start of each frame.
+// Zone time is summed over the frame, so a zone may be entered more than once per frame.
+void roxy_profiler_beginFrame(void);
+
+// Ends the current phase, if any, and begins the phase `zone`. Phases follow each other without nesting.
+void roxy_profiler_phase(int zone);
+
+// Begins and ends a zone; zones can be nested in each other and in phases
+void roxy_profiler_beginZone(int zone);
+void roxy_profiler_endZone(int zone);
+
+// Ends the current phase and stores each zone's time for the frame in its ring buffer
+void roxy_profiler_endFrame(void);
+
+// ! Stats
+// Computes a zone's min, average, max and 99th percentile time over the recorded frames, in milliseconds.
+// Returns 0 if the zone has no recorded frames.
+int roxy_profiler_getStats(int zone, float* outMin, float* outAverage, float* outMax, float* outP99);
+
+// Draws a table of every zone's stats with its top left corner at x, y
+void roxy_profiler_drawOverlay(int x, int y);
+
+// Writes every zone's stats as CSV to a file in the game's Data folder
+int roxy_profiler_dump(const char* path);
+
+// Clears the recorded frames, keeping the zones
+void roxy_profiler_reset(void);
+
+// Lua bindings
+int roxy_profiler_setEnabled_l(lua_State* L);
+int roxy_profiler_isEnabled_l(lua_State* L);
+int roxy_profiler_registerZone_l(lua_State* L);
+int roxy_profiler_beginFrame_l(lua_State* L);
+int roxy_profiler_phase_l(lua_State* L);
+int roxy_profiler_beginZone_l(lua_State* L);
+int roxy_profiler_endZone_l(lua_State* L);
+int roxy_profiler_endFrame_l(lua_State* L);
+// roxy.profiler.getStats(zone) -> min, average, max, p99 in milliseconds, or nil
+int roxy_profiler_getStats_l(lua_State* L);
+int roxy_profiler_drawOverlay_l(lua_State* L);
+int roxy_profiler_dump_l(lua_State* L);
+int roxy_profiler_reset_l(lua_State* L);
+
+#endif /* ROXY_PROFILER_H */
@@ -0,0 +1,167 @@
+#include "roxy_time.h"
+#include <math.h>
+
+static PlaydateAPI* pd = NULL;
+
+static int hasStarted = 0;  // Whether the elapsed time has been reset for the first frame
+static float rawDeltaTime = 0.0f;  // Measured time difference between frames, in seconds
+static float smoothedDeltaTime = 0.0f;  // Exponential moving average of the raw delta time
+static float deltaTime = 0.0f;  // Delta time handed to the game: smoothed if enabled, then clamped
+
+static float maxDeltaTime = 0.0f;  // Largest delta time handed to the game, or 0 for no limit
+static float smoothing = 0.0f;  // Weight of the previous average in the moving average
+
+static float fixedStep = 0.0f;  // Fixed step in seconds, or 0 when the fixed timestep is disabled
+static int maxFixedSteps = ROXY_TIME_DEFAULT_MAX_FIXED_STEPS;
+static float accumulator = 0.0f;  // Frame time not yet consumed by fixed steps
+
+void roxy_time_setPlaydateAPI(PlaydateAPI* playdate) {
+	pd = playdate;
+}
+
+// Calculates the time difference between frames
+float roxy_time_updateDeltaTime(void) {
+	if (!hasStarted) {
+		pd->system->resetElapsedTime();  // Start measuring on the first call
+		hasStarted = 1;
+		return 0.0f;
+	}
+	
+	// Sub-millisecond resolution, unlike getCurrentTimeMilliseconds
+	rawDeltaTime = pd->system->getElapsedTime();
+	pd->system->resetElapsedTime();
+	
+	if (smoothing > 0.0f && smoothedDeltaTime > 0.0f) {
+		smoothedDeltaTime = smoothing * smoothedDeltaTime + (1.0f - smoothing) * rawDeltaTime;
+	} else {
+		smoothedDeltaTime = rawDeltaTime;
+	}
+	
+	deltaTime = smoothedDeltaTime;
+	if (maxDeltaTime > 0.0f && deltaTime > maxDeltaTime) {
+		deltaTime = maxDeltaTime;  // Keep a spike from making everything jump
+	}
+	return deltaTime;
+}
+
+void roxy_time_setDeltaTimeOptions(float newMaxDeltaTime, float newSmoothing) {
+	maxDeltaTime = newMaxDeltaTime > 0.0f ? newMaxDeltaTime : 0.0f;
+	if (newSmoothing < 0.0f) {
+		newSmoothing = 0.0f;
+	} else if (newSmoothing > 0.99f) {
+		newSmoothing = 0.99f;
+	}
+	smoothing = newSmoothing;
+}
+
+void roxy_time_getFrameStats(float* outRaw, float* outSmoothed, float* outClamped) {
+	*outRaw = rawDeltaTime;
+	*outSmoothed = smoothedDeltaTime;
+	*outClamped = deltaTime;
+}
+
+// ! Fixed Timestep
+
+void roxy_time_setFixedStep(float step, int maxSteps) {
+	fixedStep = step > 0.0f ? step : 0.0f;
+	maxFixedSteps = maxSteps > 0 ? maxSteps : ROXY_TIME_DEFAULT_MAX_FIXED_STEPS;
+	accumulator = 0.0f;
+}
+
+float roxy_time_getFixedStep(void) {
+	return fixedStep;
+}
+
+int roxy_time_advanceFixedStep(float deltaTime) {
+	if (fixedStep <= 0.0f) {
+		return 0;
+	}
+	
+	accumulator += deltaTime > 0.0f ? deltaTime : 0.0f;
+	
+	int steps = (int)(accumulator / fixedStep);
+	if (steps > maxFixedSteps) {
+		// Drop the backlog, keeping the partial step for interpolation
+		steps = maxFixedSteps;
+		accumulator = fmodf(accumulator, fixedStep);
+	} else {
+		accumulator -= steps * fixedStep;
+	}
+	return steps;
+}
+
+float roxy_time_getAlpha(void) {
+	if (fixedStep <= 0.0f) {
+		return 1.0f;
+	}
+	float alpha = accumulator / fixedStep;
+	return alpha < 1.0f ? alpha : 1.0f;
+}
+
+// ! Lua Bindings
+
+// roxy.updateDeltaTime() -> deltaTime
+int roxy_time_updateDeltaTime_l(lua_State* L) {
+	(void)L;
+	
+	if (pd == NULL) {
+		return 0;
+	}
+	
+	pd->lua->pushFloat(roxy_time_updateDeltaTime());
+	return 1;
+}
+
+// roxy.time.setDeltaTimeOptions(maxDeltaTime, smoothing)
+int roxy_time_setDeltaTimeOptions_l(lua_State* L) {
+	(void)L;
+	
+	float newMaxDeltaTime = pd->lua->argIsNil(1) ? 0.0f : pd->lua->getArgFloat(1);
+	float newSmoothing = pd->lua->argIsNil(2) ? 0.0f : pd->lua->getArgFloat(2);
+	roxy_time_setDeltaTimeOptions(newMaxDeltaTime, newSmoothing);
+	return 0;
+}
+
+// roxy.getFrameStats() -> rawDeltaTime, smoothedDeltaTime, clampedDeltaTime
+int roxy_time_getFrameStats_l(lua_State* L) {
+	(void)L;
+	
+	float raw, smoothed, clamped;
+	roxy_time_getFrameStats(&raw, &smoothed, &clamped);
+	pd->lua->pushFloat(raw);
+	pd->lua->pushFloat(smoothed);
+	pd->lua->pushFloat(clamped);
+	return 3;
+}
+
+// roxy.time.setFixedStep(step, [maxSteps])
+int roxy_time_setFixedStep_l(lua_State* L) {
+	(void)L;
+	
+	int maxSteps = pd->lua->argIsNil(2) ? ROXY_TIME_DEFAULT_MAX_FIXED_STEPS : pd->lua->getArgInt(2);
+	roxy_time_setFixedStep(pd->lua->getArgFloat(1), maxSteps);
+	return 0;
+}
+
+int roxy_time_getFixedStep_l(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushFloat(roxy_time_getFixedStep());
+	return 1;
+}
+
+// roxy.time.advanceFixedStep(deltaTime) -> stepCount, alpha
+int roxy_time_advanceFixedStep_l(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushInt(roxy_time_advanceFixedStep(pd->lua->getArgFloat(1)));
+	pd->lua->pushFloat(roxy_time_getAlpha());
+	return 2;
+}
+
+int roxy_time_getAlpha_l(lua_State* L) {
+	(void)L;
+	
+	pd->lua->pushFloat(roxy_time_getAlpha());
+	return 1;
+}
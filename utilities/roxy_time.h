@@ -0,0 +1,46 @@
+#ifndef ROXY_TIME_H
+#define ROXY_TIME_H
+
+#include "pd_api.h"
+
+// Default number of fixed steps run per frame before the remaining time is dropped
+#define ROXY_TIME_DEFAULT_MAX_FIXED_STEPS 4
+
+void roxy_time_setPlaydateAPI(PlaydateAPI* playdate);
+
+// Measures the time since the previous call, in seconds, with the system's high-resolution
+// elapsed time. The elapsed time is reset each call, so it shouldn't be reset elsewhere.
+// Returns the smoothed delta time when smoothing is on, clamped to the max delta time when set.
+float roxy_time_updateDeltaTime(void);
+
+// Sets the max delta time in seconds (0 to disable clamping) and the smoothing weight of the
+// exponential moving average, from 0 (raw delta time) up to, but not including, 1
+void roxy_time_setDeltaTimeOptions(float maxDeltaTime, float smoothing);
+
+// Returns the last frame's raw, smoothed and clamped delta times
+void roxy_time_getFrameStats(float* outRaw, float* outSmoothed, float* outClamped);
+
+// ! Fixed Timestep
+// With a fixed step set, frame time is added to an accumulator and consumed in whole steps.
+// At most maxSteps run per frame; time beyond that is dropped so a long frame can't stall the next ones.
+
+// Sets the fixed step in seconds; 0 disables the fixed timestep
+void roxy_time_setFixedStep(float step, int maxSteps);
+float roxy_time_getFixedStep(void);
+
+// Adds deltaTime to the accumulator and returns the number of fixed steps to run this frame
+int roxy_time_advanceFixedStep(float deltaTime);
+
+// Returns the fraction of a step left in the accumulator, from 0 to 1, for interpolating between steps
+float roxy_time_getAlpha(void);
+
+// Lua bindings
+int roxy_time_updateDeltaTime_l(lua_State* L);
+int roxy_time_setDeltaTimeOptions_l(lua_State* L);
+int roxy_time_getFrameStats_l(lua_State* L);
+int roxy_time_setFixedStep_l(lua_State* L);
+int roxy_time_getFixedStep_l(lua_State* L);
+int roxy_time_advanceFixedStep_l(lua_State* L);
+int roxy_time_getAlpha_l(lua_State* L);
+
+#endif /* ROXY_TIME_H */